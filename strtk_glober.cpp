@@ -17,18 +17,21 @@
 
 
 /*
-   Description: This example demonstrates the use of the match functionality
-                within  the  String  Toolkit library.  The  process  takes a
-                series of inputs from the  command line and assumes them  to
-                be wild-card  patterns. The  process then  proceeds to  read
-                input  from  stdin one  line  at a  time,  printing out  the
+   Description: This example demonstrates the use of the wildcard_matcher
+                functionality within the String Toolkit library. The process
+                takes a series of inputs from the command line and assumes
+                them to be wild-card patterns. The process then proceeds  to
+                read input from stdin one line at a time, printing out the
                 patterns that successfully match the current line.
 
                 The  patterns  can  be  constructed  using  either  of   the
                 following wild-card characters:
 
-                * : match on zero or more characters ? : match on zero
-                or one character
+                * : match on zero or more characters
+                ? : match on zero or one character
+
+                All the patterns are compiled into one matcher with the same
+                semantics as strtk::match, so each line is scanned once.
 
                Example usage:
 
@@ -77,26 +80,37 @@ class line_glober
 public:
 
    line_glober(const int argc, char* argv[])
+   : matcher_(false,strtk::wildcard_matcher::e_match)
    {
       pattern_list_.reserve(argc - 1);
       strtk::parse(argc - 1,argv + 1,pattern_list_);
       std::sort(pattern_list_.begin(),pattern_list_.end());
+
+      for (std::size_t i = 0; i < pattern_list_.size(); ++i)
+      {
+         matcher_.add(pattern_list_[i]);
+      }
+
+      matcher_.compile();
    }
 
-   inline void operator()(const std::string& s) const
+   inline void operator()(const std::string& s)
    {
-      for (std::size_t i = 0; i < pattern_list_.size(); ++i)
+      match_list_.clear();
+
+      matcher_.match_all(s,std::back_inserter(match_list_));
+
+      for (std::size_t i = 0; i < match_list_.size(); ++i)
       {
-         if (strtk::match(pattern_list_[i],s))
-         {
-            std::cout << pattern_list_[i] << " matched " << s << std::endl;
-         }
+         std::cout << pattern_list_[match_list_[i]] << " matched " << s << std::endl;
       }
    }
 
 private:
 
    std::vector<std::string> pattern_list_;
+   strtk::wildcard_matcher matcher_;
+   std::vector<std::size_t> match_list_;
 };
 
 int main(int argc, char* argv[])
@@ -26,7 +26,9 @@
 
 
 #include <cstddef>
+#include <cstdio>
 #include <cstdlib>
+#include <fstream>
 #include <iostream>
 #include <iterator>
 #include <algorithm>
@@ -567,1968 +569,4667 @@ bool test_split_n()
    return true;
 }
 
-bool test_empty_filter_itr()
+template <typename Predicate>
+struct generic_predicate_wrapper
 {
-   std::string s = "a||c";
-   typedef strtk::std_string::token_vector_type str_list;
-   str_list sl;
-   strtk::single_delimiter_predicate<std::string::value_type> p('|');
-   strtk::std_string::tokenizer<>::type tok(s,p,true);
+   generic_predicate_wrapper(const Predicate& p)
+   : p_(p)
+   {}
 
-   if (2 == for_each_token(s, tok, strtk::filter_non_empty_range< std::back_insert_iterator<str_list> >(std::back_inserter(sl))))
-      return true;
-   else
+   inline bool operator()(const char c) const
    {
-      std::cout << "test_empty_filter_itr() - Failed Compressed Delimiter Test" << std::endl;
-      return false;
+      return p_(c);
    }
-}
 
-struct data_block
+   const Predicate& p_;
+};
+
+template <typename Predicate>
+bool test_split_scanner_equivalence(const Predicate& predicate, const std::string& s)
 {
-   std::string    d1;
-   char           d2;
-   int            d3;
-   unsigned int   d4;
-   double         d5;
-   float          d6;
-   short          d7;
-   unsigned short d8;
-   bool           d9;
-   unsigned char  d10;
+   typedef std::pair<const char*,const char*> range_type;
 
-   void clear(const std::size_t& i)
+   static const strtk::split_options::type split_option_list[] =
+                  {
+                     strtk::split_options::default_mode,
+                     strtk::split_options::compress_delimiters,
+                     strtk::split_options::include_1st_delimiter,
+                     strtk::split_options::include_1st_delimiter  | strtk::split_options::compress_delimiters,
+                     strtk::split_options::include_all_delimiters,
+                     strtk::split_options::include_all_delimiters | strtk::split_options::compress_delimiters
+                  };
+
+   static const std::size_t split_option_list_size = sizeof(split_option_list) / sizeof(strtk::split_options::type);
+
+   const generic_predicate_wrapper<Predicate> generic_predicate(predicate);
+
+   for (std::size_t i = 0; i < split_option_list_size; ++i)
    {
-      if (i >=  1) d1  = "";
-      if (i >=  2) d2  = 0x00;
-      if (i >=  3) d3  = 0;
-      if (i >=  4) d4  = 0;
-      if (i >=  5) d5  = 0;
-      if (i >=  6) d6  = 0;
-      if (i >=  7) d7  = 7;
-      if (i >=  8) d8  = 0;
-      if (i >=  9) d9  = false;
-      if (i >= 10) d10 = 0x00;
+      std::vector<range_type> simd_result;
+      std::vector<range_type> generic_result;
+
+      strtk::split(predicate, s.data(), s.data() + s.size(), std::back_inserter(simd_result), split_option_list[i]);
+      strtk::split(generic_predicate, s.data(), s.data() + s.size(), std::back_inserter(generic_result), split_option_list[i]);
+
+      if (simd_result != generic_result)
+      {
+         std::cout << "test_split_scanner_equivalence() - split mismatch option: " << split_option_list[i] << " input: [" << s << "]" << std::endl;
+         return false;
+      }
+
+      simd_result.clear();
+      generic_result.clear();
+
+      const std::size_t n = s.size() / 7;
+
+      strtk::split_n(predicate, s.data(), s.data() + s.size(), n, std::back_inserter(simd_result), split_option_list[i]);
+      strtk::split_n(generic_predicate, s.data(), s.data() + s.size(), n, std::back_inserter(generic_result), split_option_list[i]);
+
+      if (simd_result != generic_result)
+      {
+         std::cout << "test_split_scanner_equivalence() - split_n mismatch option: " << split_option_list[i] << " input: [" << s << "]" << std::endl;
+         return false;
+      }
    }
 
-   bool operator==(const data_block& db)
+   return true;
+}
+
+bool test_split_simd()
+{
+   static const char alphabet[] = "abc,|;\t xyz0123456789";
+   static const std::size_t alphabet_size = sizeof(alphabet) - 1;
+
+   const strtk::single_delimiter_predicate<char> single_predicate(',');
+   const strtk::multiple_char_delimiter_predicate multi_predicate(",|;\t ");
+   const strtk::multiple_char_delimiter_predicate large_predicate("abc,|;\txyz");
+
+   const strtk::static_delimiter_predicate<','> static_single_predicate;
+   const strtk::static_delimiter_predicate<'|',';'> static_pair_predicate;
+   const strtk::static_delimiter_predicate<',','|',';','\t',' '> static_multi_predicate;
+
+   for (std::size_t c = 0; c < 256; ++c)
    {
-      return d1 == db.d1 &&
-             d2 == db.d2 &&
-             d3 == db.d3 &&
-             d4 == db.d4 &&
-    !not_equal(d5,db.d5) &&
-    !not_equal(d6,db.d6) &&
-             d7 == db.d7 &&
-             d8 == db.d8 &&
-             d9 == db.d9 &&
-             d10 == db.d10;
+      if (
+           (multi_predicate (static_cast<unsigned char>(c)) != static_multi_predicate (static_cast<unsigned char>(c))) ||
+           (single_predicate(static_cast<char>(c))          != static_single_predicate(static_cast<char>(c))         )
+         )
+      {
+         std::cout << "test_split_simd() - Failed static predicate test, char: " << c << std::endl;
+         return false;
+      }
    }
 
-   bool operator!=(const data_block& db)
+   std::srand(static_cast<unsigned int>(strtk::magic_seed));
+
+   for (std::size_t length = 0; length < 300; ++length)
    {
-      return !this->operator ==(db);
+      for (std::size_t round = 0; round < 10; ++round)
+      {
+         std::string s(length,' ');
+
+         for (std::size_t i = 0; i < length; ++i)
+         {
+            s[i] = alphabet[std::rand() % alphabet_size];
+         }
+
+         if (
+              !test_split_scanner_equivalence(single_predicate,s) ||
+              !test_split_scanner_equivalence( multi_predicate,s) ||
+              !test_split_scanner_equivalence( large_predicate,s) ||
+              !test_split_scanner_equivalence(static_single_predicate,s) ||
+              !test_split_scanner_equivalence(  static_pair_predicate,s) ||
+              !test_split_scanner_equivalence( static_multi_predicate,s)
+            )
+            return false;
+      }
    }
-};
 
-inline void std_double_to_string(const double& d, std::string& s)
-{
-   char buffer[128];
-   std::size_t sz = sprintf(buffer,"%20.19e",d);
-   buffer[sz] = 0;
-   s.assign(buffer);
+   return true;
 }
 
-inline bool strtk_isnan(const double& v)
+struct batch_collector
 {
-   volatile double d = v;
-   return d != d;
-}
+   typedef std::pair<const char*,const char*> range_type;
 
-bool test_fast_convert()
+   batch_collector()
+   : batch_count(0)
+   {}
+
+   inline void operator()(const range_type* batch, const std::size_t& count)
+   {
+      token_list.insert(token_list.end(), batch, batch + count);
+      ++batch_count;
+   }
+
+   std::vector<range_type> token_list;
+   std::size_t batch_count;
+};
+
+bool test_split_batch()
 {
+   typedef std::pair<const char*,const char*> range_type;
+
+   static const char alphabet[] = "abc,|;\t xyz0123456789";
+   static const std::size_t alphabet_size = sizeof(alphabet) - 1;
+
+   static const strtk::split_options::type split_option_list[] =
+                  {
+                     strtk::split_options::default_mode,
+                     strtk::split_options::compress_delimiters,
+                     strtk::split_options::include_1st_delimiter,
+                     strtk::split_options::include_all_delimiters | strtk::split_options::compress_delimiters
+                  };
+
+   static const std::size_t split_option_list_size = sizeof(split_option_list) / sizeof(strtk::split_options::type);
+
+   static const std::size_t capacity_list[] = { 1, 3, 256 };
+
+   const strtk::multiple_char_delimiter_predicate predicate(",|;\t ");
+
+   std::srand(static_cast<unsigned int>(strtk::magic_seed));
+
+   range_type batch[256];
+
+   for (std::size_t length = 0; length < 1000; length += 7)
    {
-      int v = 0;
-      for (int i = -100000000; i < +100000000; ++i)
+      std::string s(length,' ');
+
+      for (std::size_t i = 0; i < length; ++i)
       {
-         if (!strtk::fast::signed_numeric_convert(strtk::type_to_string(i), v, true))
+         s[i] = alphabet[std::rand() % alphabet_size];
+      }
+
+      for (std::size_t i = 0; i < split_option_list_size; ++i)
+      {
+         std::vector<range_type> expected;
+
+         strtk::split(predicate, s.data(), s.data() + s.size(), std::back_inserter(expected), split_option_list[i]);
+
+         for (std::size_t j = 0; j < 3; ++j)
          {
-            std::cout << "test_fast_convert() - Failed Fast convert 1  i = " << i << std::endl;
+            batch_collector collector;
+
+            const std::size_t token_count = strtk::split_batch(predicate,
+                                                               s.data(), s.data() + s.size(),
+                                                               batch, capacity_list[j],
+                                                               collector,
+                                                               split_option_list[i]);
+
+            const std::size_t expected_batch_count = (expected.size() + capacity_list[j] - 1) / capacity_list[j];
+
+            if (
+                 (token_count != expected.size()) ||
+                 (collector.token_list != expected) ||
+                 (collector.batch_count != expected_batch_count)
+               )
+            {
+               std::cout << "test_split_batch() - Failed split_batch test, option: " << split_option_list[i]
+                         << " capacity: " << capacity_list[j] << " input: [" << s << "]" << std::endl;
+               return false;
+            }
          }
+      }
 
-         if (i != v)
+      {
+         typedef strtk::std_string::tokenizer<strtk::multiple_char_delimiter_predicate>::type tokenizer_type;
+
+         tokenizer_type tokenizer(s,predicate,strtk::tokenize_options::compress_delimiters);
+
+         std::vector<range_type> expected(tokenizer.begin(),tokenizer.end());
+
+         batch_collector collector;
+
+         if (
+              (expected.size() != tokenizer.for_each_batch(batch,3,collector)) ||
+              (collector.token_list != expected)
+            )
          {
-            std::cout << "test_fast_convert() - Failed Fast convert 2 "
-                      << " i = " << i
-                      << " v = " << v << std::endl;
+            std::cout << "test_split_batch() - Failed tokenizer batch test, input: [" << s << "]" << std::endl;
             return false;
          }
       }
    }
 
+   return true;
+}
+
+bool test_regex_dfa()
+{
+   typedef std::pair<const char*,const char*> range_type;
+
    {
-      unsigned int v = 0;
-      for (unsigned int i = 0; i < 1000000000; ++i)
-      {
-         if (!strtk::fast::numeric_convert(strtk::type_to_string(i), v, true))
-         {
-            std::cout << "test_fast_convert() - Failed Fast convert 1  i = " << i << std::endl;
-         }
+      static const char* invalid_list[] = { "a(", "(a|b", "^a", "a$", "a{2,1}", "\\1", "a*?", "[a-", "*a", "(?=a)" };
+      static const std::size_t invalid_list_size = sizeof(invalid_list) / sizeof(const char*);
 
-         if (i != v)
+      for (std::size_t i = 0; i < invalid_list_size; ++i)
+      {
+         if (!(!strtk::regex_dfa(invalid_list[i])))
          {
-            std::cout << "test_fast_convert() - Failed Fast convert 2  "
-                      << "i = " << i
-                      << "v = " << v << std::endl;
+            std::cout << "test_regex_dfa() - Failed invalid expression test: " << invalid_list[i] << std::endl;
             return false;
          }
       }
    }
 
    {
-      std::string s[] = {
-                            "0000000000000000",   "1111111111111111",   "2222222222222222",   "3333333333333333",   "4444444444444444",
-                            "5555555555555555",   "6666666666666666",   "1234567890123456",   "9876543210987654",   "1919191919191919",
-                           "00000000000000000",  "11111111111111111",  "22222222222222222",  "33333333333333333",  "44444444444444444",
-                           "55555555555555555",  "66666666666666666",  "12345678901234567",  "98765432109876543",  "19191919191919191",
-                          "000000000000000000", "111111111111111111", "222222222222222222", "333333333333333333", "444444444444444444",
-                          "555555555555555555", "666666666666666666", "123456789012345677", "987654321098765432", "191919191919191919"
-                        };
-
-      unsigned long long v[] = {
-                              0000000000000000LL,   1111111111111111LL,   2222222222222222LL,   3333333333333333LL,   4444444444444444LL,
-                              5555555555555555LL,   6666666666666666LL,   1234567890123456LL,   9876543210987654LL,   1919191919191919LL,
-                             00000000000000000LL,  11111111111111111LL,  22222222222222222LL,  33333333333333333LL,  44444444444444444LL,
-                             55555555555555555LL,  66666666666666666LL,  12345678901234567LL,  98765432109876543LL,  19191919191919191LL,
-                            000000000000000000LL, 111111111111111111LL, 222222222222222222LL, 333333333333333333LL, 444444444444444444LL,
-                            555555555555555555LL, 666666666666666666LL, 123456789012345677LL, 987654321098765432LL, 191919191919191919LL
-                        };
-
-      for (std::size_t i = 0 ; i < (sizeof(s) / sizeof(std::string)); ++i)
+      struct test_case
       {
-         unsigned long long t = 0;
-         strtk::fast::numeric_convert(s[i],t);
-         if (t != v[i])
+         const char* expression;
+         const char* text;
+         const char* expected;
+      };
+
+      static const test_case test_list[] =
          {
-            strtk::fast::numeric_convert(s[i],t);
+            { "[0-9]+(\\.[0-9]+)?"          , "a1 b22.5 c.3 x7."                 , "1|22.5|3|7"              },
+            { "(\\d{1,3}\\.){3}\\d{1,3}"     , "at 192.168.0.1 or 10.0.0.255."    , "192.168.0.1|10.0.0.255"  },
+            { "ab|abcd"                     , "xabcdab"                          , "abcd|ab"                 },
+            { "(?:foo|bar)+"                , "foobarbaz barfoo"                 , "foobar|barfoo"           },
+            { "\\x41[^\\s,]*"                , "AB, xA-1 A"                       , "AB|A-1|A"                },
+            { "[]a-]+"                      , "x]a-b"                            , "]a-"                     },
+            { "\\w+@\\w+(\\.\\w+)+"            , "mail bob@example.com, x@y"        , "bob@example.com"         },
+            { "a*"                          , "baaab"                            , "aaa"                     },
+            { "colou?r"                     , "color colour colouur"             , "color|colour"            }
+         };
+
+      static const std::size_t test_list_size = sizeof(test_list) / sizeof(test_case);
+
+      for (std::size_t i = 0; i < test_list_size; ++i)
+      {
+         const strtk::regex_dfa expression(test_list[i].expression);
 
-            std::cout << "test_fast_convert() - Failed Fast convert Special Test unsigned long long "
-                      << " index = " << i
-                      << " t = " << t
-                      << " v[index] = " << v[i] << std::endl;
+         std::vector<std::string> match_list;
+
+         strtk::split_regex(expression,
+                            std::string(test_list[i].text),
+                            strtk::range_to_type_back_inserter(match_list));
+
+         const std::string result = strtk::join("|",match_list);
+
+         if (!expression || (result != test_list[i].expected))
+         {
+            std::cout << "test_regex_dfa() - Failed match test: " << test_list[i].expression
+                      << " result: " << result << std::endl;
             return false;
          }
       }
    }
 
-   return true;
-
-}
-
-bool test_double_convert()
-{
    {
-      static const std::string fract10_str[] =
-                   {
-                      "0.0",
-                      "1.0E+001", "1.0E+002", "1.0E+003", "1.0E+004", "1.0E+005", "1.0E+006", "1.0E+007", "1.0E+008", "1.0E+009", "1.0E+010",
-                      "1.0E+011", "1.0E+012", "1.0E+013", "1.0E+014", "1.0E+015", "1.0E+016", "1.0E+017", "1.0E+018", "1.0E+019", "1.0E+020",
-                      "1.0E+021", "1.0E+022", "1.0E+023", "1.0E+024", "1.0E+025", "1.0E+026", "1.0E+027", "1.0E+028", "1.0E+029", "1.0E+030",
-                      "1.0E+031", "1.0E+032", "1.0E+033", "1.0E+034", "1.0E+035", "1.0E+036", "1.0E+037", "1.0E+038", "1.0E+039", "1.0E+040",
-                      "1.0E+041", "1.0E+042", "1.0E+043", "1.0E+044", "1.0E+045", "1.0E+046", "1.0E+047", "1.0E+048", "1.0E+049", "1.0E+050",
-                      "1.0E+051", "1.0E+052", "1.0E+053", "1.0E+054", "1.0E+055", "1.0E+056", "1.0E+057", "1.0E+058", "1.0E+059", "1.0E+060",
-                      "1.0E+061", "1.0E+062", "1.0E+063", "1.0E+064", "1.0E+065", "1.0E+066", "1.0E+067", "1.0E+068", "1.0E+069", "1.0E+070",
-                      "1.0E+071", "1.0E+072", "1.0E+073", "1.0E+074", "1.0E+075", "1.0E+076", "1.0E+077", "1.0E+078", "1.0E+079", "1.0E+080",
-                      "1.0E+081", "1.0E+082", "1.0E+083", "1.0E+084", "1.0E+085", "1.0E+086", "1.0E+087", "1.0E+088", "1.0E+089", "1.0E+090",
-                      "1.0E+091", "1.0E+092", "1.0E+093", "1.0E+094", "1.0E+095", "1.0E+096", "1.0E+097", "1.0E+098", "1.0E+099", "1.0E+100",
-                      "1.0E+101", "1.0E+102", "1.0E+103", "1.0E+104", "1.0E+105", "1.0E+106", "1.0E+107", "1.0E+108", "1.0E+109", "1.0E+110",
-                      "1.0E+111", "1.0E+112", "1.0E+113", "1.0E+114", "1.0E+115", "1.0E+116", "1.0E+117", "1.0E+118", "1.0E+119", "1.0E+120",
-                      "1.0E+121", "1.0E+122", "1.0E+123", "1.0E+124", "1.0E+125", "1.0E+126", "1.0E+127", "1.0E+128", "1.0E+129", "1.0E+130",
-                      "1.0E+131", "1.0E+132", "1.0E+133", "1.0E+134", "1.0E+135", "1.0E+136", "1.0E+137", "1.0E+138", "1.0E+139", "1.0E+140",
-                      "1.0E+141", "1.0E+142", "1.0E+143", "1.0E+144", "1.0E+145", "1.0E+146", "1.0E+147", "1.0E+148", "1.0E+149", "1.0E+150",
-                      "1.0E+151", "1.0E+152", "1.0E+153", "1.0E+154", "1.0E+155", "1.0E+156", "1.0E+157", "1.0E+158", "1.0E+159", "1.0E+160",
-                      "1.0E+161", "1.0E+162", "1.0E+163", "1.0E+164", "1.0E+165", "1.0E+166", "1.0E+167", "1.0E+168", "1.0E+169", "1.0E+170",
-                      "1.0E+171", "1.0E+172", "1.0E+173", "1.0E+174", "1.0E+175", "1.0E+176", "1.0E+177", "1.0E+178", "1.0E+179", "1.0E+180",
-                      "1.0E+181", "1.0E+182", "1.0E+183", "1.0E+184", "1.0E+185", "1.0E+186", "1.0E+187", "1.0E+188", "1.0E+189", "1.0E+190",
-                      "1.0E+191", "1.0E+192", "1.0E+193", "1.0E+194", "1.0E+195", "1.0E+196", "1.0E+197", "1.0E+198", "1.0E+199", "1.0E+200",
-                      "1.0E+201", "1.0E+202", "1.0E+203", "1.0E+204", "1.0E+205", "1.0E+206", "1.0E+207", "1.0E+208", "1.0E+209", "1.0E+210",
-                      "1.0E+211", "1.0E+212", "1.0E+213", "1.0E+214", "1.0E+215", "1.0E+216", "1.0E+217", "1.0E+218", "1.0E+219", "1.0E+220",
-                      "1.0E+221", "1.0E+222", "1.0E+223", "1.0E+224", "1.0E+225", "1.0E+226", "1.0E+227", "1.0E+228", "1.0E+229", "1.0E+230",
-                      "1.0E+231", "1.0E+232", "1.0E+233", "1.0E+234", "1.0E+235", "1.0E+236", "1.0E+237", "1.0E+238", "1.0E+239", "1.0E+240",
-                      "1.0E+241", "1.0E+242", "1.0E+243", "1.0E+244", "1.0E+245", "1.0E+246", "1.0E+247", "1.0E+248", "1.0E+249", "1.0E+250",
-                      "1.0E+251", "1.0E+252", "1.0E+253", "1.0E+254", "1.0E+255", "1.0E+256", "1.0E+257", "1.0E+258", "1.0E+259", "1.0E+260",
-                      "1.0E+261", "1.0E+262", "1.0E+263", "1.0E+264", "1.0E+265", "1.0E+266", "1.0E+267", "1.0E+268", "1.0E+269", "1.0E+270",
-                      "1.0E+271", "1.0E+272", "1.0E+273", "1.0E+274", "1.0E+275", "1.0E+276", "1.0E+277", "1.0E+278", "1.0E+279", "1.0E+280",
-                      "1.0E+281", "1.0E+282", "1.0E+283", "1.0E+284", "1.0E+285", "1.0E+286", "1.0E+287", "1.0E+288", "1.0E+289", "1.0E+290",
-                      "1.0E+291", "1.0E+292", "1.0E+293", "1.0E+294", "1.0E+295", "1.0E+296", "1.0E+297", "1.0E+298", "1.0E+299", "1.0E+300",
-                      "1.0E+301", "1.0E+302", "1.0E+303", "1.0E+304", "1.0E+305", "1.0E+306", "1.0E+307", "1.0E+308"
-                   };
+      const strtk::regex_dfa expression("\\s*[,;]\\s*");
+      const std::string text = "a , b;c ,; d";
 
-      const std::size_t dbl_size = sizeof(fract10_str) / sizeof(std::string);
+      std::vector<std::string> token_list;
 
-      bool result = true;
+      strtk::split(expression, text, strtk::range_to_type_back_inserter(token_list));
 
-      for (std::size_t i = 1; i < dbl_size; ++i)
+      if ("a|b|c||d" != strtk::join("|",token_list))
       {
-         double d = std::numeric_limits<double>::quiet_NaN();
+         std::cout << "test_regex_dfa() - Failed split test" << std::endl;
+         return false;
+      }
 
-         if (!strtk::string_to_type_converter(fract10_str[i],d))
-         {
-            std::cout << "test_double_convert() exp10 test convert failure [" << i << "] "
-                      << "str: ["<< fract10_str[i] << "]" << std::endl;
-            result = false;
-         }
+      token_list.clear();
 
-         if (not_equal(d,std::pow(10.0,1.0 * i)))
-         {
-            std::cout << "test_double_convert() exp10 test value check failure [" << i << "] "
-                      << "str: ["  << fract10_str[i] << "]  "
-                      << "value: " << d << " "
-                      << "cmpv : " << std::pow(10.0,1.0 * i) << std::endl;
-            result= false;
-         }
-      }
+      strtk::split_n(expression, text.data(), text.data() + text.size(), 2, strtk::range_to_type_back_inserter(token_list));
 
-      if (!result)
+      if ("a|b" != strtk::join("|",token_list))
+      {
+         std::cout << "test_regex_dfa() - Failed split_n test" << std::endl;
          return false;
+      }
    }
 
    {
-      static const std::string double_str[] =
+      static const char* expression_list[] = { "a*b", "ab|abcd", "(a|ab)(c|bcd)", "b+a|a", "a*", "(ab)*c?", "c|[ab]{2,3}", "a?b*a" };
+      static const std::size_t expression_list_size = sizeof(expression_list) / sizeof(const char*);
+
+      std::srand(static_cast<unsigned int>(strtk::magic_seed));
+
+      for (std::size_t i = 0; i < expression_list_size; ++i)
+      {
+         const strtk::regex_dfa expression(expression_list[i]);
+
+         for (std::size_t j = 0; j < 1000; ++j)
+         {
+            std::string s(std::rand() % 20,' ');
+
+            for (std::size_t k = 0; k < s.size(); ++k)
+            {
+               s[k] = "abcd"[std::rand() % 4];
+            }
+
+            const char* begin = s.data();
+            const char* end   = s.data() + s.size();
+
+            range_type expected(end,end);
+
+            for (const char* itr = begin; end != itr; ++itr)
+            {
+               const char* match_end = expression.match(itr,end);
+
+               if (itr != match_end)
+               {
+                  expected = range_type(itr,match_end);
+                  break;
+               }
+            }
+
+            range_type result(end,end);
+
+            const bool found = expression.find(begin,end,result);
+
+            if ((found != (expected.first != end)) || (found && (result != expected)))
+            {
+               std::cout << "test_regex_dfa() - Failed find test: " << expression_list[i]
+                         << " input: [" << s << "]" << std::endl;
+               return false;
+            }
+         }
+      }
+   }
+
+   {
+      // Takes minutes if a failed match is retried from every position.
+      const std::string text(1000000,'a');
+
+      std::vector<std::string> token_list;
+
+      strtk::split(strtk::regex_dfa("a*b"), text, strtk::range_to_type_back_inserter(token_list));
+
+      if ((1 != token_list.size()) || (text != token_list[0]))
+      {
+         std::cout << "test_regex_dfa() - Failed single pass find test" << std::endl;
+         return false;
+      }
+   }
+
+   static const char alphabet[] = "abc,|;\t xyz0123456789";
+   static const std::size_t alphabet_size = sizeof(alphabet) - 1;
+
+   static const strtk::split_options::type split_option_list[] =
                   {
-                       "7379973.6624700",          "+2187496.9290991",            "384281.3720002",
-                     "06603499.49182570",            "-80173.0014819",             "+00693.000285",
-                            "-0.6366299",             "+0.2335175000",               "-00.6366299",
-                        "+00.2335175000",              "-000.6366299",           "+000.2335175000",
-                             "123.456e3",                 "123.456E3",                "123.456e+3",
-                            "123.456E+3",                "123.456e03",                "123.456E03",
-                           "123.456e+03",               "123.456E+03",              "123.456e0003",
-                          "123.456E0003",             "123.456e+0003",             "123.456E+0003",
-                            "123.4560e3",               "123.45600E3",             "123.456000e+3",
-                         "123.456000E+3",            "123.4560000e03",           "123.45600000E03",
-                     "123.456000000e+03",        "123.4560000000E+03",      "123.45600000000e0003",
-                 "123.456000000000E0003",   "123.4560000000000e+0003",  "123.45600000000000E+0003",
-                         "+0123.456e+003",          "-00123.456E+003",           "+000123.45600E3",
-                             "-123.456e3",               "+123.456E3",               "-123.456e+3",
-                            "+123.456E+3",              "-123.456e03",               "+123.456E03",
-                           "-123.456e123",             "+123.456E123",             "-123.456e+123",
-                          "+123.456E+123",            "-123.456e0123",             "+123.456E0123",
-                           "-123.456e+03",             "+123.456E+03",             "-123.456e0003",
-                          "+123.456E0003",           "-123.456e+0003",            "+123.456E+0003",
-                            "-123.4560e3",             "+123.45600E3",            "-123.456000e+3",
-                         "+123.456000E+3",          "-123.4560000e03",          "+123.45600000E03",
-                     "-123.456000000e+03",      "+123.4560000000E+03",     "-123.45600000000e0003",
-                 "+123.456000000000E0003", "-123.4560000000000e+0003", "+123.45600000000000E+0003",
-                         "-0123.456e+003",          "+00123.456E+003",           "-000123.45600E3",
-                   "000000123.456e+0003",                       "0.0",                     "00.00",
-                                "0.0e10",                     "0e+10",                     "0e-10",
-                               "-0.0e10",                     "+0e10",                    "00e010",
-                               "000.000",                 "0000.0000",                     "1234.",
-                                  "01.2",                  "0012.340",               "00012.34500",
-                                     "0",                       "123",                      "0123",
-                                 "00123",                      "-123",                      "+123",
-                       "0",    "1",    "2",    "3",    "4",    "5",    "6",    "7",    "8",    "9",
-                      "+0",   "+1",   "+2",   "+3",   "+4",   "+5",   "+6",   "+7",   "+8",   "+9",
-                      "-0",   "-1",   "-2",   "-3",   "-4",   "-5",   "-6",   "-7",   "-8",   "-9",
-                     "0.0",  "1.0",  "2.0",  "3.0",  "4.0",  "5.0",  "6.0",  "7.0",  "8.0",  "9.0",
-                    "+0.0", "+1.0", "+2.0", "+3.0", "+4.0", "+5.0", "+6.0", "+7.0", "+8.0", "+9.0",
-                    "-0.0", "-1.0", "-2.0", "-3.0", "-4.0", "-5.0", "-6.0", "-7.0", "-8.0", "-9.0",
-           ".0e+0",  ".1e+1",  ".2e+2",  ".3e+3",  ".4e+4",  ".5e+5",  ".6e+6",  ".7e+7",  ".8e+8",  ".9e+9",
-          ".00e+0", ".01e+1", ".02e+2", ".03e+3", ".04e+4", ".05e+5", ".06e+6", ".07e+7", ".08e+8", ".09e+9",
-          ".0e+00", ".1e+01", ".2e+02", ".3e+03", ".4e+04", ".5e+05", ".6e+06", ".7e+07", ".8e+08", ".9e+09",
-           ".0E+0",  ".1E+1",  ".2E+2",  ".3E+3",  ".4E+4",  ".5E+5",  ".6E+6",  ".7E+7",  ".8E+8",  ".9E+9",
-          ".00E+0", ".01E+1", ".02E+2", ".03E+3", ".04E+4", ".05E+5", ".06E+6", ".07E+7", ".08E+8", ".09E+9",
-          ".0E+00", ".1E+01", ".2E+02", ".3E+03", ".4E+04", ".5E+05", ".6E+06", ".7E+07", ".8E+08", ".9E+09",
-          "+.0e+0", "+.1e+1", "+.2e+2", "+.3e+3", "+.4e+4", "+.5e+5", "+.6e+6", "+.7e+7", "+.8e+8", "+.9e+9",
-          "-.0e+0", "-.1e+1", "-.2e+2", "-.3e+3", "-.4e+4", "-.5e+5", "-.6e+6", "-.7e+7", "-.8e+8", "-.9e+9",
-                   "0.",  "1.",  "2.",  "3.",  "4.",  "5.",  "6.",  "7.",  "8.",  "9.",
-                  "+0.", "+1.", "+2.", "+3.", "+4.", "+5.", "+6.", "+7.", "+8.", "+9.",
-                  "-0.", "-1.", "-2.", "-3.", "-4.", "-5.", "-6.", "-7.", "-8.", "-9.",
-                  ".0",  ".1",  ".2",  ".3",  ".4",  ".5",  ".6",  ".7",  ".8",  ".9",
-                  "-.0",  "-.1",  "-.2",  "-.3",  "-.4",  "-.5",  "-.6",  "-.7",  "-.8",  "-.9",
-                  "+.0",  "+.1",  "+.2",  "+.3",  "+.4",  "+.5",  "+.6",  "+.7",  "+.8",  "+.9",
-          "+0.0f", "+1.0f", "+2.0f", "+3.0f", "+4.0f", "+5.0f", "+6.0f", "+7.0f", "+8.0f", "+9.0f",
-          "+0.0F", "+1.0F", "+2.0F", "+3.0F", "+4.0F", "+5.0F", "+6.0F", "+7.0F", "+8.0F", "+9.0F",
-          "+0.0l", "+1.0l", "+2.0l", "+3.0l", "+4.0l", "+5.0l", "+6.0l", "+7.0l", "+8.0l", "+9.0l",
-          "+0.0L", "+1.0L", "+2.0L", "+3.0L", "+4.0L", "+5.0L", "+6.0L", "+7.0L", "+8.0L", "+9.0L",
-          "-0.0f", "-1.0f", "-2.0f", "-3.0f", "-4.0f", "-5.0f", "-6.0f", "-7.0f", "-8.0f", "-9.0f",
-          "-0.0F", "-1.0F", "-2.0F", "-3.0F", "-4.0F", "-5.0F", "-6.0F", "-7.0F", "-8.0F", "-9.0F",
-          "-0.0l", "-1.0l", "-2.0l", "-3.0l", "-4.0l", "-5.0l", "-6.0l", "-7.0l", "-8.0l", "-9.0l",
-          "-0.0L", "-1.0L", "-2.0L", "-3.0L", "-4.0L", "-5.0L", "-6.0L", "-7.0L", "-8.0L", "-9.0L",
-          "+0.0e+1f", "+1.0e+1f", "+2.0e+1f", "+3.0e+1f", "+4.0e+1f", "+5.0e+1f", "+6.0e+1f", "+7.0e+1f", "+8.0e+1f", "+9.0e+1f",
-          "+0.0E-2F", "+1.0E-2F", "+2.0E-2F", "+3.0E-2F", "+4.0E-2F", "+5.0E-2F", "+6.0E-2F", "+7.0E-2F", "+8.0E-2F", "+9.0E-2F",
-          "+0.0e+3l", "+1.0e+3l", "+2.0e+3l", "+3.0e+3l", "+4.0e+3l", "+5.0e+3l", "+6.0e+3l", "+7.0e+3l", "+8.0e+3l", "+9.0e+3l",
-          "+0.0E-4L", "+1.0E-4L", "+2.0E-4L", "+3.0E-4L", "+4.0E-4L", "+5.0E-4L", "+6.0E-4L", "+7.0E-4L", "+8.0E-4L", "+9.0E-4L",
-          "-0.0e+5f", "-1.0e+5f", "-2.0e+5f", "-3.0e+5f", "-4.0e+5f", "-5.0e+5f", "-6.0e+5f", "-7.0e+5f", "-8.0e+5f", "-9.0e+5f",
-          "-0.0E-6F", "-1.0E-6F", "-2.0E-6F", "-3.0E-6F", "-4.0E-6F", "-5.0E-6F", "-6.0E-6F", "-7.0E-6F", "-8.0E-6F", "-9.0E-6F",
-          "-0.0e+7l", "-1.0e+7l", "-2.0e+7l", "-3.0e+7l", "-4.0e+7l", "-5.0e+7l", "-6.0e+7l", "-7.0e+7l", "-8.0e+7l", "-9.0e+7l",
-          "-0.0E-8L", "-1.0E-8L", "-2.0E-8L", "-3.0E-8L", "-4.0E-8L", "-5.0E-8L", "-6.0E-8L", "-7.0E-8L", "-8.0E-8L", "-9.0E-8L",
-         "0.1", "0.01", "0.001", "0.0001", "0.00001", "0.000001", "0.0000001", "0.00000001", "0.000000001",
-         "0.2", "0.02", "0.002", "0.0002", "0.00002", "0.000002", "0.0000002", "0.00000002", "0.000000002",
-         "0.3", "0.03", "0.003", "0.0003", "0.00003", "0.000003", "0.0000003", "0.00000003", "0.000000003",
-         "0.4", "0.04", "0.004", "0.0004", "0.00004", "0.000004", "0.0000004", "0.00000004", "0.000000004",
-         "0.5", "0.05", "0.005", "0.0005", "0.00005", "0.000005", "0.0000005", "0.00000005", "0.000000005",
-         "0.6", "0.06", "0.006", "0.0006", "0.00006", "0.000006", "0.0000006", "0.00000006", "0.000000006",
-         "0.7", "0.07", "0.007", "0.0007", "0.00007", "0.000007", "0.0000007", "0.00000007", "0.000000007",
-         "0.8", "0.08", "0.008", "0.0008", "0.00008", "0.000008", "0.0000008", "0.00000008", "0.000000008",
-         "0.9", "0.09", "0.009", "0.0009", "0.00009", "0.000009", "0.0000009", "0.00000009", "0.000000009",
-         "+0.1", "+0.01", "+0.001", "+0.0001", "+0.00001", "+0.000001", "+0.0000001", "+0.00000001", "+0.000000001",
-         "+0.2", "+0.02", "+0.002", "+0.0002", "+0.00002", "+0.000002", "+0.0000002", "+0.00000002", "+0.000000002",
-         "+0.3", "+0.03", "+0.003", "+0.0003", "+0.00003", "+0.000003", "+0.0000003", "+0.00000003", "+0.000000003",
-         "+0.4", "+0.04", "+0.004", "+0.0004", "+0.00004", "+0.000004", "+0.0000004", "+0.00000004", "+0.000000004",
-         "+0.5", "+0.05", "+0.005", "+0.0005", "+0.00005", "+0.000005", "+0.0000005", "+0.00000005", "+0.000000005",
-         "+0.6", "+0.06", "+0.006", "+0.0006", "+0.00006", "+0.000006", "+0.0000006", "+0.00000006", "+0.000000006",
-         "+0.7", "+0.07", "+0.007", "+0.0007", "+0.00007", "+0.000007", "+0.0000007", "+0.00000007", "+0.000000007",
-         "+0.8", "+0.08", "+0.008", "+0.0008", "+0.00008", "+0.000008", "+0.0000008", "+0.00000008", "+0.000000008",
-         "+0.9", "+0.09", "+0.009", "+0.0009", "+0.00009", "+0.000009", "+0.0000009", "+0.00000009", "+0.000000009",
-         "-0.1", "-0.01", "-0.001", "-0.0001", "-0.00001", "-0.000001", "-0.0000001", "-0.00000001", "-0.000000001",
-         "-0.2", "-0.02", "-0.002", "-0.0002", "-0.00002", "-0.000002", "-0.0000002", "-0.00000002", "-0.000000002",
-         "-0.3", "-0.03", "-0.003", "-0.0003", "-0.00003", "-0.000003", "-0.0000003", "-0.00000003", "-0.000000003",
-         "-0.4", "-0.04", "-0.004", "-0.0004", "-0.00004", "-0.000004", "-0.0000004", "-0.00000004", "-0.000000004",
-         "-0.5", "-0.05", "-0.005", "-0.0005", "-0.00005", "-0.000005", "-0.0000005", "-0.00000005", "-0.000000005",
-         "-0.6", "-0.06", "-0.006", "-0.0006", "-0.00006", "-0.000006", "-0.0000006", "-0.00000006", "-0.000000006",
-         "-0.7", "-0.07", "-0.007", "-0.0007", "-0.00007", "-0.000007", "-0.0000007", "-0.00000007", "-0.000000007",
-         "-0.8", "-0.08", "-0.008", "-0.0008", "-0.00008", "-0.000008", "-0.0000008", "-0.00000008", "-0.000000008",
-         "-0.9", "-0.09", "-0.009", "-0.0009", "-0.00009", "-0.000009", "-0.0000009", "-0.00000009", "-0.000000009",
-                         "1.01", "0.101", "1.0101", "0.10101", "1.010101", "0.1010101", "1.01010101", "1.101010101",
-                         "2.02", "0.202", "2.0202", "0.20202", "2.020202", "0.2020202", "2.02020202", "2.202020202",
-                         "3.03", "0.303", "3.0303", "0.30303", "3.030303", "0.3030303", "3.03030303", "3.303030303",
-                         "4.04", "0.404", "4.0404", "0.40404", "4.040404", "0.4040404", "4.04040404", "4.404040404",
-                         "5.05", "0.505", "5.0505", "0.50505", "5.050505", "0.5050505", "5.05050505", "5.505050505",
-                         "6.06", "0.606", "6.0606", "0.60606", "6.060606", "0.6060606", "6.06060606", "6.606060606",
-                         "7.07", "0.707", "7.0707", "0.70707", "7.070707", "0.7070707", "7.07070707", "7.707070707",
-                         "8.08", "0.808", "8.0808", "0.80808", "8.080808", "0.8080808", "8.08080808", "8.808080808",
-                         "9.09", "0.909", "9.0909", "0.90909", "9.090909", "0.9090909", "9.09090909", "9.909090909",
-                 "+1.01", "+0.101", "+1.0101", "+0.10101", "+1.010101", "+0.1010101", "+1.01010101", "+1.101010101",
-                 "+2.02", "+0.202", "+2.0202", "+0.20202", "+2.020202", "+0.2020202", "+2.02020202", "+2.202020202",
-                 "+3.03", "+0.303", "+3.0303", "+0.30303", "+3.030303", "+0.3030303", "+3.03030303", "+3.303030303",
-                 "+4.04", "+0.404", "+4.0404", "+0.40404", "+4.040404", "+0.4040404", "+4.04040404", "+4.404040404",
-                 "+5.05", "+0.505", "+5.0505", "+0.50505", "+5.050505", "+0.5050505", "+5.05050505", "+5.505050505",
-                 "+6.06", "+0.606", "+6.0606", "+0.60606", "+6.060606", "+0.6060606", "+6.06060606", "+6.606060606",
-                 "+7.07", "+0.707", "+7.0707", "+0.70707", "+7.070707", "+0.7070707", "+7.07070707", "+7.707070707",
-                 "+8.08", "+0.808", "+8.0808", "+0.80808", "+8.080808", "+0.8080808", "+8.08080808", "+8.808080808",
-                 "+9.09", "+0.909", "+9.0909", "+0.90909", "+9.090909", "+0.9090909", "+9.09090909", "+9.909090909",
-                 "-1.01", "-0.101", "-1.0101", "-0.10101", "-1.010101", "-0.1010101", "-1.01010101", "-1.101010101",
-                 "-2.02", "-0.202", "-2.0202", "-0.20202", "-2.020202", "-0.2020202", "-2.02020202", "-2.202020202",
-                 "-3.03", "-0.303", "-3.0303", "-0.30303", "-3.030303", "-0.3030303", "-3.03030303", "-3.303030303",
-                 "-4.04", "-0.404", "-4.0404", "-0.40404", "-4.040404", "-0.4040404", "-4.04040404", "-4.404040404",
-                 "-5.05", "-0.505", "-5.0505", "-0.50505", "-5.050505", "-0.5050505", "-5.05050505", "-5.505050505",
-                 "-6.06", "-0.606", "-6.0606", "-0.60606", "-6.060606", "-0.6060606", "-6.06060606", "-6.606060606",
-                 "-7.07", "-0.707", "-7.0707", "-0.70707", "-7.070707", "-0.7070707", "-7.07070707", "-7.707070707",
-                 "-8.08", "-0.808", "-8.0808", "-0.80808", "-8.080808", "-0.8080808", "-8.08080808", "-8.808080808",
-                 "-9.09", "-0.909", "-9.0909", "-0.90909", "-9.090909", "-0.9090909", "-9.09090909", "-9.909090909",
-                  "+inf",         "-inf",
-                  "+INF",         "-INF",
-                  "+1.0#inf", "-1.0#inf",
-                  "+1.0#INF", "-1.0#INF",
-                  "+infinity",         "-infinity",
-                  "+INFINITY",         "-INFINITY",
-                  "+1.0#infinity", "-1.0#infinity",
-                  "+1.0#INFINITY", "-1.0#INFINITY",
-                       "NAN",    "nan",
-                   "1.0#NAN", "1.0#nan"
+                     strtk::split_options::default_mode,
+                     strtk::split_options::compress_delimiters,
+                     strtk::split_options::include_1st_delimiter,
+                     strtk::split_options::include_1st_delimiter  | strtk::split_options::compress_delimiters,
+                     strtk::split_options::include_all_delimiters,
+                     strtk::split_options::include_all_delimiters | strtk::split_options::compress_delimiters
                   };
 
-      static const double d[] =
-                  {
-                        7379973.6624700,          +2187496.9290991,            384281.3720002,
-                      06603499.49182570,            -80173.0014819,             +00693.000285,
-                             -0.6366299,             +0.2335175000,               -00.6366299,
-                         +00.2335175000,              -000.6366299,           +000.2335175000,
-                              123.456e3,                 123.456E3,                123.456e+3,
-                             123.456E+3,                123.456e03,                123.456E03,
-                            123.456e+03,               123.456E+03,              123.456e0003,
-                           123.456E0003,             123.456e+0003,             123.456E+0003,
-                             123.4560e3,               123.45600E3,             123.456000e+3,
-                          123.456000E+3,            123.4560000e03,           123.45600000E03,
-                      123.456000000e+03,        123.4560000000E+03,      123.45600000000e0003,
-                  123.456000000000E0003,   123.4560000000000e+0003,  123.45600000000000E+0003,
-                          +0123.456e+003,          -00123.456E+003,           +000123.45600E3,
-                              -123.456e3,               +123.456E3,               -123.456e+3,
-                             +123.456E+3,              -123.456e03,               +123.456E03,
-                            -123.456e123,             +123.456E123,             -123.456e+123,
-                           +123.456E+123,            -123.456e0123,             +123.456E0123,
-                            -123.456e+03,             +123.456E+03,             -123.456e0003,
-                           +123.456E0003,           -123.456e+0003,            +123.456E+0003,
-                             -123.4560e3,             +123.45600E3,            -123.456000e+3,
-                          +123.456000E+3,          -123.4560000e03,          +123.45600000E03,
-                      -123.456000000e+03,      +123.4560000000E+03,     -123.45600000000e0003,
-                  +123.456000000000E0003, -123.4560000000000e+0003, +123.45600000000000E+0003,
-                           -123.456e+003,            +123.456E+003,              -123.45600E3,
-                           123.456e+0003,                      0.0,                       0.0,
-                                     0.0,                      0.0,                       0.0,
-                                     0.0,                      0.0,                       0.0,
-                                     0.0,                      0.0,                     1234.,
-                                     1.2,                    12.34,                  12.34500,
-                                       0,                      123,                       123,
-                                     123,                     -123,                      +123,
-                                    0.0,  1.0,  2.0,  3.0,  4.0,  5.0,  6.0,  7.0,  8.0,  9.0,
-                                   +0.0, +1.0, +2.0, +3.0, +4.0, +5.0, +6.0, +7.0, +8.0, +9.0,
-                                   -0.0, -1.0, -2.0, -3.0, -4.0, -5.0, -6.0, -7.0, -8.0, -9.0,
-                                    0.0,  1.0,  2.0,  3.0,  4.0,  5.0,  6.0,  7.0,  8.0,  9.0,
-                                   +0.0, +1.0, +2.0, +3.0, +4.0, +5.0, +6.0, +7.0, +8.0, +9.0,
-                                   -0.0, -1.0, -2.0, -3.0, -4.0, -5.0, -6.0, -7.0, -8.0, -9.0,
-                 .0e+0,  .1e+1,  .2e+2,  .3e+3,  .4e+4,  .5e+5,  .6e+6,  .7e+7,  .8e+8,  .9e+9,
-                .00e+0, .01e+1, .02e+2, .03e+3, .04e+4, .05e+5, .06e+6, .07e+7, .08e+8, .09e+9,
-                .0e+00, .1e+01, .2e+02, .3e+03, .4e+04, .5e+05, .6e+06, .7e+07, .8e+08, .9e+09,
-                 .0E+0,  .1E+1,  .2E+2,  .3E+3,  .4E+4,  .5E+5,  .6E+6,  .7E+7,  .8E+8,  .9E+9,
-                .00E+0, .01E+1, .02E+2, .03E+3, .04E+4, .05E+5, .06E+6, .07E+7, .08E+8, .09E+9,
-                .0E+00, .1E+01, .2E+02, .3E+03, .4E+04, .5E+05, .6E+06, .7E+07, .8E+08, .9E+09,
-                +.0e+0, +.1e+1, +.2e+2, +.3e+3, +.4e+4, +.5e+5, +.6e+6, +.7e+7, +.8e+8, +.9e+9,
-                -.0e+0, -.1e+1, -.2e+2, -.3e+3, -.4e+4, -.5e+5, -.6e+6, -.7e+7, -.8e+8, -.9e+9,
-                                     0.0,  1.0,  2.0,  3.0,  4.0,  5.0,  6.0,  7.0,  8.0,  9.0,
-                                    +0.0, +1.0, +2.0, +3.0, +4.0, +5.0, +6.0, +7.0, +8.0, +9.0,
-                                    -0.0, -1.0, -2.0, -3.0, -4.0, -5.0, -6.0, -7.0, -8.0, -9.0,
-                            0.0,   0.1,   0.2,   0.3,   0.4,   0.5 ,  0.6,   0.7,   0.8,   0.9,
-                           -0.0,  -0.1,  -0.2,  -0.3,  -0.4,  -0.5,  -0.6,  -0.7,  -0.8,  -0.9,
-                           +0.0,  +0.1,  +0.2,  +0.3,  +0.4,  +0.5,  +0.6,  +0.7,  +0.8,  +0.9,
-                                    +0.0, +1.0, +2.0, +3.0, +4.0, +5.0, +6.0, +7.0, +8.0, +9.0,
-                                    +0.0, +1.0, +2.0, +3.0, +4.0, +5.0, +6.0, +7.0, +8.0, +9.0,
-                                    +0.0, +1.0, +2.0, +3.0, +4.0, +5.0, +6.0, +7.0, +8.0, +9.0,
-                                    +0.0, +1.0, +2.0, +3.0, +4.0, +5.0, +6.0, +7.0, +8.0, +9.0,
-                                    -0.0, -1.0, -2.0, -3.0, -4.0, -5.0, -6.0, -7.0, -8.0, -9.0,
-                                    -0.0, -1.0, -2.0, -3.0, -4.0, -5.0, -6.0, -7.0, -8.0, -9.0,
-                                    -0.0, -1.0, -2.0, -3.0, -4.0, -5.0, -6.0, -7.0, -8.0, -9.0,
-                                    -0.0, -1.0, -2.0, -3.0, -4.0, -5.0, -6.0, -7.0, -8.0, -9.0,
-      +0.0e+1, +1.0e+1, +2.0e+1, +3.0e+1, +4.0e+1, +5.0e+1, +6.0e+1, +7.0e+1, +8.0e+1, +9.0e+1,
-      +0.0E-2, +1.0E-2, +2.0E-2, +3.0E-2, +4.0E-2, +5.0E-2, +6.0E-2, +7.0E-2, +8.0E-2, +9.0E-2,
-      +0.0e+3, +1.0e+3, +2.0e+3, +3.0e+3, +4.0e+3, +5.0e+3, +6.0e+3, +7.0e+3, +8.0e+3, +9.0e+3,
-      +0.0E-4, +1.0E-4, +2.0E-4, +3.0E-4, +4.0E-4, +5.0E-4, +6.0E-4, +7.0E-4, +8.0E-4, +9.0E-4,
-      -0.0e+5, -1.0e+5, -2.0e+5, -3.0e+5, -4.0e+5, -5.0e+5, -6.0e+5, -7.0e+5, -8.0e+5, -9.0e+5,
-      -0.0E-6, -1.0E-6, -2.0E-6, -3.0E-6, -4.0E-6, -5.0E-6, -6.0E-6, -7.0E-6, -8.0E-6, -9.0E-6,
-      -0.0e+7, -1.0e+7, -2.0e+7, -3.0e+7, -4.0e+7, -5.0e+7, -6.0e+7, -7.0e+7, -8.0e+7, -9.0e+7,
-      -0.0E-8, -1.0E-8, -2.0E-8, -3.0E-8, -4.0E-8, -5.0E-8, -6.0E-8, -7.0E-8, -8.0E-8, -9.0E-8,
-               0.1, 0.01, 0.001, 0.0001, 0.00001, 0.000001, 0.0000001, 0.00000001, 0.000000001,
-               0.2, 0.02, 0.002, 0.0002, 0.00002, 0.000002, 0.0000002, 0.00000002, 0.000000002,
-               0.3, 0.03, 0.003, 0.0003, 0.00003, 0.000003, 0.0000003, 0.00000003, 0.000000003,
-               0.4, 0.04, 0.004, 0.0004, 0.00004, 0.000004, 0.0000004, 0.00000004, 0.000000004,
-               0.5, 0.05, 0.005, 0.0005, 0.00005, 0.000005, 0.0000005, 0.00000005, 0.000000005,
-               0.6, 0.06, 0.006, 0.0006, 0.00006, 0.000006, 0.0000006, 0.00000006, 0.000000006,
-               0.7, 0.07, 0.007, 0.0007, 0.00007, 0.000007, 0.0000007, 0.00000007, 0.000000007,
-               0.8, 0.08, 0.008, 0.0008, 0.00008, 0.000008, 0.0000008, 0.00000008, 0.000000008,
-               0.9, 0.09, 0.009, 0.0009, 0.00009, 0.000009, 0.0000009, 0.00000009, 0.000000009,
-      +0.1, +0.01, +0.001, +0.0001, +0.00001, +0.000001, +0.0000001, +0.00000001, +0.000000001,
-      +0.2, +0.02, +0.002, +0.0002, +0.00002, +0.000002, +0.0000002, +0.00000002, +0.000000002,
-      +0.3, +0.03, +0.003, +0.0003, +0.00003, +0.000003, +0.0000003, +0.00000003, +0.000000003,
-      +0.4, +0.04, +0.004, +0.0004, +0.00004, +0.000004, +0.0000004, +0.00000004, +0.000000004,
-      +0.5, +0.05, +0.005, +0.0005, +0.00005, +0.000005, +0.0000005, +0.00000005, +0.000000005,
-      +0.6, +0.06, +0.006, +0.0006, +0.00006, +0.000006, +0.0000006, +0.00000006, +0.000000006,
-      +0.7, +0.07, +0.007, +0.0007, +0.00007, +0.000007, +0.0000007, +0.00000007, +0.000000007,
-      +0.8, +0.08, +0.008, +0.0008, +0.00008, +0.000008, +0.0000008, +0.00000008, +0.000000008,
-      +0.9, +0.09, +0.009, +0.0009, +0.00009, +0.000009, +0.0000009, +0.00000009, +0.000000009,
-      -0.1, -0.01, -0.001, -0.0001, -0.00001, -0.000001, -0.0000001, -0.00000001, -0.000000001,
-      -0.2, -0.02, -0.002, -0.0002, -0.00002, -0.000002, -0.0000002, -0.00000002, -0.000000002,
-      -0.3, -0.03, -0.003, -0.0003, -0.00003, -0.000003, -0.0000003, -0.00000003, -0.000000003,
-      -0.4, -0.04, -0.004, -0.0004, -0.00004, -0.000004, -0.0000004, -0.00000004, -0.000000004,
-      -0.5, -0.05, -0.005, -0.0005, -0.00005, -0.000005, -0.0000005, -0.00000005, -0.000000005,
-      -0.6, -0.06, -0.006, -0.0006, -0.00006, -0.000006, -0.0000006, -0.00000006, -0.000000006,
-      -0.7, -0.07, -0.007, -0.0007, -0.00007, -0.000007, -0.0000007, -0.00000007, -0.000000007,
-      -0.8, -0.08, -0.008, -0.0008, -0.00008, -0.000008, -0.0000008, -0.00000008, -0.000000008,
-      -0.9, -0.09, -0.009, -0.0009, -0.00009, -0.000009, -0.0000009, -0.00000009, -0.000000009,
-                    1.01, 0.101, 1.0101, 0.10101, 1.010101, 0.1010101, 1.01010101, 1.101010101,
-                    2.02, 0.202, 2.0202, 0.20202, 2.020202, 0.2020202, 2.02020202, 2.202020202,
-                    3.03, 0.303, 3.0303, 0.30303, 3.030303, 0.3030303, 3.03030303, 3.303030303,
-                    4.04, 0.404, 4.0404, 0.40404, 4.040404, 0.4040404, 4.04040404, 4.404040404,
-                    5.05, 0.505, 5.0505, 0.50505, 5.050505, 0.5050505, 5.05050505, 5.505050505,
-                    6.06, 0.606, 6.0606, 0.60606, 6.060606, 0.6060606, 6.06060606, 6.606060606,
-                    7.07, 0.707, 7.0707, 0.70707, 7.070707, 0.7070707, 7.07070707, 7.707070707,
-                    8.08, 0.808, 8.0808, 0.80808, 8.080808, 0.8080808, 8.08080808, 8.808080808,
-                    9.09, 0.909, 9.0909, 0.90909, 9.090909, 0.9090909, 9.09090909, 9.909090909,
-            +1.01, +0.101, +1.0101, +0.10101, +1.010101, +0.1010101, +1.01010101, +1.101010101,
-            +2.02, +0.202, +2.0202, +0.20202, +2.020202, +0.2020202, +2.02020202, +2.202020202,
-            +3.03, +0.303, +3.0303, +0.30303, +3.030303, +0.3030303, +3.03030303, +3.303030303,
-            +4.04, +0.404, +4.0404, +0.40404, +4.040404, +0.4040404, +4.04040404, +4.404040404,
-            +5.05, +0.505, +5.0505, +0.50505, +5.050505, +0.5050505, +5.05050505, +5.505050505,
-            +6.06, +0.606, +6.0606, +0.60606, +6.060606, +0.6060606, +6.06060606, +6.606060606,
-            +7.07, +0.707, +7.0707, +0.70707, +7.070707, +0.7070707, +7.07070707, +7.707070707,
-            +8.08, +0.808, +8.0808, +0.80808, +8.080808, +0.8080808, +8.08080808, +8.808080808,
-            +9.09, +0.909, +9.0909, +0.90909, +9.090909, +0.9090909, +9.09090909, +9.909090909,
-            -1.01, -0.101, -1.0101, -0.10101, -1.010101, -0.1010101, -1.01010101, -1.101010101,
-            -2.02, -0.202, -2.0202, -0.20202, -2.020202, -0.2020202, -2.02020202, -2.202020202,
-            -3.03, -0.303, -3.0303, -0.30303, -3.030303, -0.3030303, -3.03030303, -3.303030303,
-            -4.04, -0.404, -4.0404, -0.40404, -4.040404, -0.4040404, -4.04040404, -4.404040404,
-            -5.05, -0.505, -5.0505, -0.50505, -5.050505, -0.5050505, -5.05050505, -5.505050505,
-            -6.06, -0.606, -6.0606, -0.60606, -6.060606, -0.6060606, -6.06060606, -6.606060606,
-            -7.07, -0.707, -7.0707, -0.70707, -7.070707, -0.7070707, -7.07070707, -7.707070707,
-            -8.08, -0.808, -8.0808, -0.80808, -8.080808, -0.8080808, -8.08080808, -8.808080808,
-            -9.09, -0.909, -9.0909, -0.90909, -9.090909, -0.9090909, -9.09090909, -9.909090909,
-            +std::numeric_limits<double>::infinity(), -std::numeric_limits<double>::infinity(),
-            +std::numeric_limits<double>::infinity(), -std::numeric_limits<double>::infinity(),
-            +std::numeric_limits<double>::infinity(), -std::numeric_limits<double>::infinity(),
-            +std::numeric_limits<double>::infinity(), -std::numeric_limits<double>::infinity(),
-            +std::numeric_limits<double>::infinity(), -std::numeric_limits<double>::infinity(),
-            +std::numeric_limits<double>::infinity(), -std::numeric_limits<double>::infinity(),
-            +std::numeric_limits<double>::infinity(), -std::numeric_limits<double>::infinity(),
-            +std::numeric_limits<double>::infinity(), -std::numeric_limits<double>::infinity(),
-             std::numeric_limits<double>::quiet_NaN(), std::numeric_limits<double>::quiet_NaN(),
-             std::numeric_limits<double>::quiet_NaN(), std::numeric_limits<double>::quiet_NaN(),
-           };
+   static const std::size_t split_option_list_size = sizeof(split_option_list) / sizeof(strtk::split_options::type);
+
+   const strtk::regex_dfa expression("[,|;\t ]");
+   const strtk::multiple_char_delimiter_predicate predicate(",|;\t ");
+
+   std::srand(static_cast<unsigned int>(strtk::magic_seed));
+
+   for (std::size_t length = 0; length < 200; ++length)
+   {
+      std::string s(length,' ');
+
+      for (std::size_t i = 0; i < length; ++i)
+      {
+         s[i] = alphabet[std::rand() % alphabet_size];
+      }
+
+      for (std::size_t i = 0; i < split_option_list_size; ++i)
+      {
+         std::vector<range_type> expected;
+         std::vector<range_type> result;
+
+         strtk::split(predicate , s.data(), s.data() + s.size(), std::back_inserter(expected), split_option_list[i]);
+         strtk::split(expression, s.data(), s.data() + s.size(), std::back_inserter(result  ), split_option_list[i]);
+
+         if (result != expected)
+         {
+            std::cout << "test_regex_dfa() - Failed split equivalence test, option: " << split_option_list[i]
+                      << " input: [" << s << "]" << std::endl;
+            return false;
+         }
+      }
+   }
+
+   return true;
+}
+
+bool test_multi_pattern_matcher()
+{
+   typedef strtk::multi_pattern_matcher::match_t match_t;
+
+   static const char alphabet[] = "abcAB";
+   static const std::size_t alphabet_size = sizeof(alphabet) - 1;
+
+   std::srand(static_cast<unsigned int>(strtk::magic_seed));
+
+   for (std::size_t round = 0; round < 200; ++round)
+   {
+      std::vector<std::string> pattern_list;
+
+      for (std::size_t i = 0; i < (1 + round % 20); ++i)
+      {
+         std::string pattern(1 + std::rand() % 5,' ');
+
+         for (std::size_t j = 0; j < pattern.size(); ++j)
+         {
+            pattern[j] = alphabet[std::rand() % alphabet_size];
+         }
+
+         pattern_list.push_back(pattern);
+      }
+
+      pattern_list.push_back(pattern_list[0]);
+      pattern_list.push_back("");
+
+      std::string data(round * 5,' ');
+
+      for (std::size_t i = 0; i < data.size(); ++i)
+      {
+         data[i] = alphabet[std::rand() % alphabet_size];
+      }
+
+      for (std::size_t mode = 0; mode < 2; ++mode)
+      {
+         const bool case_insensitive = (1 == mode);
+
+         const strtk::multi_pattern_matcher matcher(pattern_list,case_insensitive);
+
+         std::vector<match_t> expected;
+
+         for (std::size_t end = 1; end <= data.size(); ++end)
+         {
+            std::vector<std::pair<std::size_t,std::size_t> > match_list;
+
+            for (std::size_t id = 0; id < pattern_list.size(); ++id)
+            {
+               const std::string& pattern = pattern_list[id];
+
+               if (pattern.empty() || (pattern.size() > end))
+                  continue;
+
+               const std::string candidate = data.substr(end - pattern.size(),pattern.size());
+
+               if (case_insensitive ? strtk::imatch(candidate,pattern) : (candidate == pattern))
+                  match_list.push_back(std::make_pair(pattern.size(),id));
+            }
+
+            // Longest first, identical patterns by ascending id
+            std::sort(match_list.begin(),match_list.end());
+
+            for (std::size_t i = match_list.size(); i > 0; --i)
+            {
+               std::size_t j = i - 1;
+
+               while ((j > 0) && (match_list[j - 1].first == match_list[i - 1].first)) --j;
+
+               for (std::size_t k = j; k < i; ++k)
+               {
+                  expected.push_back(match_t(match_list[k].second,end - match_list[k].first));
+               }
+
+               i = j + 1;
+            }
+         }
+
+         std::vector<match_t> result;
+
+         const std::size_t match_count = strtk::find_all(matcher,data,std::back_inserter(result));
+
+         if ((match_count != expected.size()) || (result != expected))
+         {
+            std::cout << "test_multi_pattern_matcher() - Failed match test, round: " << round
+                      << " case insensitive: " << case_insensitive << std::endl;
+            return false;
+         }
+      }
+   }
+
+   return true;
+}
+
+bool test_substring_searcher()
+{
+   typedef std::pair<const char*,const char*> range_t;
+
+   static const char alphabet[] = "abAB";
+   static const std::size_t alphabet_size = sizeof(alphabet) - 1;
+
+   std::srand(static_cast<unsigned int>(strtk::magic_seed));
+
+   for (std::size_t round = 0; round < 400; ++round)
+   {
+      std::string data(std::rand() % 200,' ');
+
+      for (std::size_t i = 0; i < data.size(); ++i)
+      {
+         data[i] = alphabet[std::rand() % alphabet_size];
+      }
+
+      std::string pattern(1 + std::rand() % ((round % 4) ? 4 : 40),' ');
+
+      for (std::size_t i = 0; i < pattern.size(); ++i)
+      {
+         pattern[i] = alphabet[std::rand() % alphabet_size];
+      }
+
+      const char* begin = data.data();
+      const char* end   = data.data() + data.size();
+
+      std::vector<range_t> expected;
+      std::vector<range_t> result;
+
+      strtk::find_all(pattern.data(), pattern.data() + pattern.size(), begin, end, expected);
+
+      if (
+           (strtk::find_all(pattern,data,result) != expected.size()) ||
+           (result != expected) ||
+           (strtk::substring_searcher(pattern).find(data.begin(),data.end()) != std::search(data.begin(),data.end(),pattern.begin(),pattern.end()))
+         )
+      {
+         std::cout << "test_substring_searcher() - Failed find_all test, round: " << round << std::endl;
+         return false;
+      }
+
+      expected.clear();
+      result.clear();
+
+      strtk::ifind_all(pattern.data(), pattern.data() + pattern.size(), begin, end, std::back_inserter(expected));
+
+      const strtk::substring_searcher isearcher(pattern,true);
+
+      if (
+           (strtk::find_all(isearcher,data,result) != expected.size()) ||
+           (result != expected) ||
+           (strtk::ifind(pattern,data) != (expected.empty() ? std::string::npos : std::size_t(expected[0].first - begin)))
+         )
+      {
+         std::cout << "test_substring_searcher() - Failed ifind_all test, round: " << round << std::endl;
+         return false;
+      }
+
+      std::string replaced;
+      std::string naive;
+
+      strtk::replace_pattern(data,pattern,"xyz",replaced);
+
+      std::string r = "xyz";
+      strtk::replace_pattern(data.begin(), data.end(),
+                             pattern.begin(), pattern.end(),
+                             r.begin(), r.end(),
+                             std::back_inserter(naive));
+
+      if (replaced != naive)
+      {
+         std::cout << "test_substring_searcher() - Failed replace_pattern test, round: " << round << std::endl;
+         return false;
+      }
+   }
+
+   return true;
+}
+
+bool test_multi_pattern_replace()
+{
+   typedef std::map<std::string,std::string> table_t;
+
+   static const char alphabet[] = "abcAB";
+   static const std::size_t alphabet_size = sizeof(alphabet) - 1;
+
+   std::srand(static_cast<unsigned int>(strtk::magic_seed));
+
+   for (std::size_t round = 0; round < 300; ++round)
+   {
+      table_t table;
+
+      for (std::size_t i = 0; i < (1 + round % 25); ++i)
+      {
+         std::string pattern(std::rand() % 6,' ');
+
+         for (std::size_t j = 0; j < pattern.size(); ++j)
+         {
+            pattern[j] = alphabet[std::rand() % alphabet_size];
+         }
+
+         table[pattern] = strtk::type_to_string(i);
+      }
+
+      std::string data(round,' ');
+
+      for (std::size_t i = 0; i < data.size(); ++i)
+      {
+         data[i] = alphabet[std::rand() % alphabet_size];
+      }
+
+      for (std::size_t mode = 0; mode < 2; ++mode)
+      {
+         const bool case_insensitive = (1 == mode);
+
+         std::string expected;
+         std::size_t expected_count = 0;
+         std::size_t pos = 0;
+
+         while (pos < data.size())
+         {
+            table_t::const_iterator best = table.end();
+
+            for (table_t::const_iterator itr = table.begin(); table.end() != itr; ++itr)
+            {
+               const std::string& pattern = itr->first;
+
+               if (pattern.empty() || ((pos + pattern.size()) > data.size()))
+                  continue;
+               else if ((table.end() != best) && (pattern.size() <= best->first.size()))
+                  continue;
+
+               const std::string candidate = data.substr(pos,pattern.size());
+
+               if (case_insensitive ? strtk::imatch(candidate,pattern) : (candidate == pattern))
+                  best = itr;
+            }
+
+            if (table.end() != best)
+            {
+               expected += best->second;
+               pos += best->first.size();
+               ++expected_count;
+            }
+            else
+               expected += data[pos++];
+         }
+
+         const strtk::multi_pattern_replacer replacer(table,case_insensitive);
+
+         std::string result;
+
+         if (
+              (strtk::replace_pattern(data,replacer,result) != expected_count) ||
+              (result != expected)
+            )
+         {
+            std::cout << "test_multi_pattern_replace() - Failed replace test, round: " << round
+                      << " case insensitive: " << case_insensitive << std::endl;
+            return false;
+         }
+      }
+   }
+
+   return true;
+}
+
+bool glob_reference(const std::string& pattern, const std::string& data, const bool icase)
+{
+   // reachable[j] : pattern prefix matches the first j characters of data
+   std::vector<bool> reachable(data.size() + 1,false);
+   reachable[0] = true;
+
+   for (std::size_t i = 0; i < pattern.size(); ++i)
+   {
+      std::vector<bool> next(data.size() + 1,false);
+
+      for (std::size_t j = 0; j <= data.size(); ++j)
+      {
+         if (!reachable[j])
+            continue;
+
+         const char c = pattern[i];
+
+         if ('*' == c)
+         {
+            for (std::size_t k = j; k <= data.size(); ++k) next[k] = true;
+         }
+         else if ('?' == c)
+         {
+            next[j] = true;
+            if (j < data.size()) next[j + 1] = true;
+         }
+         else if ((j < data.size()) && (icase ? strtk::imatch_char(c,data[j]) : (c == data[j])))
+            next[j + 1] = true;
+      }
+
+      reachable.swap(next);
+   }
+
+   return reachable[data.size()];
+}
+
+// strtk::match, rejecting where it would search past the end of the data
+bool match_reference(const std::string& pattern, const std::string& data, const bool icase)
+{
+   std::size_t p = 0;
+   std::size_t d = 0;
+
+   while ((p < pattern.size()) && (d < data.size()))
+   {
+      if ('*' == pattern[p])
+      {
+         while ((p < pattern.size()) && (('*' == pattern[p]) || ('?' == pattern[p]))) ++p;
+
+         if (pattern.size() == p)
+            return true;
+
+         const char c = pattern[p++];
+
+         while ((d < data.size()) && !(icase ? strtk::imatch_char(c,data[d]) : (c == data[d]))) ++d;
+
+         if (data.size() == d)
+            return false;
+
+         ++d;
+      }
+      else if (('?' == pattern[p]) || (icase ? strtk::imatch_char(pattern[p],data[d]) : (pattern[p] == data[d])))
+      {
+         ++p;
+         ++d;
+      }
+      else
+         return false;
+   }
+
+   if (d != data.size())
+      return false;
+   else if ((p < pattern.size()) && (('*' == pattern[p]) || ('?' == pattern[p])))
+      ++p;
+
+   return (pattern.size() == p);
+}
+
+bool test_wildcard_matcher()
+{
+   static const char alphabet[] = "abAB*?";
+   static const std::size_t alphabet_size = sizeof(alphabet) - 1;
+
+   std::srand(static_cast<unsigned int>(strtk::magic_seed));
+
+   for (std::size_t round = 0; round < 300; ++round)
+   {
+      std::vector<std::string> pattern_list;
+
+      for (std::size_t i = 0; i < (1 + round % 8); ++i)
+      {
+         std::string pattern(std::rand() % 7,' ');
+
+         for (std::size_t j = 0; j < pattern.size(); ++j)
+         {
+            pattern[j] = alphabet[std::rand() % alphabet_size];
+         }
+
+         pattern_list.push_back(pattern);
+      }
+
+      // Forces the simulation fallback
+      if (0 == (round % 10))
+      {
+         pattern_list.push_back("*a?b?a?b?a?b?a?b?a?b?a?b?a?b?a?b?a?b?a?b?a?b?a?b?a?b");
+         pattern_list.push_back("*b?a?b?b?a?a?b?a?b?b?a?b?a?b?b?a?a?b?a?b?b?a");
+      }
+
+      for (std::size_t mode = 0; mode < 4; ++mode)
+      {
+         const bool case_insensitive = (1 == (mode & 1));
+         const strtk::wildcard_matcher::semantics semantics = (mode < 2) ?
+                                                              strtk::wildcard_matcher::e_glob :
+                                                              strtk::wildcard_matcher::e_match;
+
+         const strtk::wildcard_matcher matcher(pattern_list,case_insensitive,semantics);
+
+         if ((0 == (round % 10)) && (0 != matcher.state_count()) && (mode < 2))
+         {
+            std::cout << "test_wildcard_matcher() - Failed fallback test, round: " << round << std::endl;
+            return false;
+         }
+
+         for (std::size_t k = 0; k < 20; ++k)
+         {
+            std::string data(std::rand() % 48,' ');
+
+            for (std::size_t i = 0; i < data.size(); ++i)
+            {
+               data[i] = alphabet[std::rand() % 4];
+            }
+
+            std::vector<std::size_t> expected;
+
+            for (std::size_t id = 0; id < pattern_list.size(); ++id)
+            {
+               const std::string& pattern = pattern_list[id];
+
+               const bool matched = (mode < 2) ?
+                                    glob_reference (pattern,data,case_insensitive) :
+                                    match_reference(pattern,data,case_insensitive);
+
+               if (matched)
+               {
+                  expected.push_back(id);
+               }
+            }
+
+            std::vector<std::size_t> result;
+
+            if (
+                 (matcher.match_all(data,std::back_inserter(result)) != expected.size()) ||
+                 (result != expected) ||
+                 (matcher.match(data) != !expected.empty()) ||
+                 (strtk::wildcard_matcher(pattern_list[0],case_insensitive,semantics).match(data) != (!expected.empty() && (0 == expected[0])))
+               )
+            {
+               std::cout << "test_wildcard_matcher() - Failed match test, round: " << round
+                         << " case insensitive: " << case_insensitive
+                         << " semantics: " << semantics << std::endl;
+               return false;
+            }
+         }
+      }
+   }
+
+   // Documented differences from strtk::match
+   if (
+        strtk::match("*a" ,"aba") || !strtk::wildcard_matcher("*a" ).match(std::string("aba")) ||
+        strtk::match("a?c","ac" ) || !strtk::wildcard_matcher("a?c").match(std::string("ac" ))
+      )
+   {
+      std::cout << "test_wildcard_matcher() - Failed match difference test" << std::endl;
+      return false;
+   }
+
+   {
+      static const char* test_list[][2] =
+                           {
+                              { "*a"       , "aba"      },
+                              { "a?c"      , "ac"       },
+                              { "a?c"      , "abc"      },
+                              { "a*"       , "a"        },
+                              { "a**"      , "a"        },
+                              { "a**"      , "ab"       },
+                              { "ab?"      , "ab"       },
+                              { "??"       , ""         },
+                              { "??"       , "a"        },
+                              { "*"        , ""         },
+                              { ""         , ""         },
+                              { "*.cpp"    , "x.cpp"    },
+                              { "*.cpp"    , "x.hpp"    },
+                              { "M?kef*le" , "Makefile" },
+                              { "*?b*c"    , "abbc"     },
+                              { "*b"       , "abab"     }
+                           };
+
+      static const std::size_t test_list_size = sizeof(test_list) / sizeof(test_list[0]);
+
+      for (std::size_t i = 0; i < test_list_size; ++i)
+      {
+         const std::string pattern = test_list[i][0];
+         const std::string data    = test_list[i][1];
+
+         const strtk::wildcard_matcher matcher(pattern,false,strtk::wildcard_matcher::e_match);
+
+         if (matcher.match(data) != strtk::match(pattern,data))
+         {
+            std::cout << "test_wildcard_matcher() - Failed match semantics test: " << pattern << " " << data << std::endl;
+            return false;
+         }
+      }
+   }
+
+   return true;
+}
+
+bool test_case_conversion_kernels()
+{
+   static const char alphabet[] = "aAzZ@[`{09 \x7F\x80\xC0\xE0\xFF";
+   static const std::size_t alphabet_size = sizeof(alphabet) - 1;
+
+   std::srand(static_cast<unsigned int>(strtk::magic_seed));
+
+   for (std::size_t round = 0; round < 2000; ++round)
+   {
+      std::string s1(std::rand() % 100,' ');
+
+      for (std::size_t i = 0; i < s1.size(); ++i)
+      {
+         // Mostly ASCII so that whole blocks take the vectorised path
+         s1[i] = (std::rand() % 8) ? static_cast<char>(0x20 + std::rand() % 0x5F) : alphabet[std::rand() % alphabet_size];
+      }
+
+      std::string upper = s1;
+      std::string lower = s1;
+
+      for (std::size_t i = 0; i < s1.size(); ++i)
+      {
+         upper[i] = static_cast<char>(::toupper(static_cast<int>(static_cast<unsigned char>(s1[i]))));
+         lower[i] = static_cast<char>(::tolower(static_cast<int>(static_cast<unsigned char>(s1[i]))));
+      }
+
+      if ((strtk::as_uppercase(s1) != upper) || (strtk::as_lowercase(s1) != lower))
+      {
+         std::cout << "test_case_conversion_kernels() - Failed conversion test, round: " << round << std::endl;
+         return false;
+      }
+
+      std::string s2 = (round & 1) ? lower : upper;
+
+      if (!s2.empty() && (0 == (round % 3)))
+         s2[std::rand() % s2.size()] = alphabet[std::rand() % alphabet_size];
+
+      const std::size_t n = s2.empty() ? 0 : std::rand() % s2.size();
+      const std::string prefix = s2.substr(0,n);
+      const std::string suffix = s2.substr(s2.size() - n);
+
+      const char* b1 = s1.data();
+      const char* e1 = s1.data() + s1.size();
+
+      if (
+           (strtk::imatch(s1,s2) != strtk::imatch(b1, e1, s2.data(), s2.data() + s2.size())) ||
+           (strtk::ibegins_with(prefix,s1) != strtk::ibegins_with(prefix.data(), prefix.data() + prefix.size(), b1, e1)) ||
+           (strtk::iends_with  (suffix,s1) != strtk::iends_with  (suffix.data(), suffix.data() + suffix.size(), b1, e1))
+         )
+      {
+         std::cout << "test_case_conversion_kernels() - Failed comparison test, round: " << round << std::endl;
+         return false;
+      }
+   }
+
+   return true;
+}
+
+bool test_empty_filter_itr()
+{
+   std::string s = "a||c";
+   typedef strtk::std_string::token_vector_type str_list;
+   str_list sl;
+   strtk::single_delimiter_predicate<std::string::value_type> p('|');
+   strtk::std_string::tokenizer<>::type tok(s,p,true);
+
+   if (2 == for_each_token(s, tok, strtk::filter_non_empty_range< std::back_insert_iterator<str_list> >(std::back_inserter(sl))))
+      return true;
+   else
+   {
+      std::cout << "test_empty_filter_itr() - Failed Compressed Delimiter Test" << std::endl;
+      return false;
+   }
+}
+
+struct data_block
+{
+   std::string    d1;
+   char           d2;
+   int            d3;
+   unsigned int   d4;
+   double         d5;
+   float          d6;
+   short          d7;
+   unsigned short d8;
+   bool           d9;
+   unsigned char  d10;
+
+   void clear(const std::size_t& i)
+   {
+      if (i >=  1) d1  = "";
+      if (i >=  2) d2  = 0x00;
+      if (i >=  3) d3  = 0;
+      if (i >=  4) d4  = 0;
+      if (i >=  5) d5  = 0;
+      if (i >=  6) d6  = 0;
+      if (i >=  7) d7  = 7;
+      if (i >=  8) d8  = 0;
+      if (i >=  9) d9  = false;
+      if (i >= 10) d10 = 0x00;
+   }
+
+   bool operator==(const data_block& db)
+   {
+      return d1 == db.d1 &&
+             d2 == db.d2 &&
+             d3 == db.d3 &&
+             d4 == db.d4 &&
+    !not_equal(d5,db.d5) &&
+    !not_equal(d6,db.d6) &&
+             d7 == db.d7 &&
+             d8 == db.d8 &&
+             d9 == db.d9 &&
+             d10 == db.d10;
+   }
+
+   bool operator!=(const data_block& db)
+   {
+      return !this->operator ==(db);
+   }
+};
+
+inline void std_double_to_string(const double& d, std::string& s)
+{
+   char buffer[128];
+   std::size_t sz = sprintf(buffer,"%20.19e",d);
+   buffer[sz] = 0;
+   s.assign(buffer);
+}
+
+inline bool strtk_isnan(const double& v)
+{
+   volatile double d = v;
+   return d != d;
+}
+
+bool test_fast_convert()
+{
+   {
+      int v = 0;
+      for (int i = -100000000; i < +100000000; ++i)
+      {
+         if (!strtk::fast::signed_numeric_convert(strtk::type_to_string(i), v, true))
+         {
+            std::cout << "test_fast_convert() - Failed Fast convert 1  i = " << i << std::endl;
+         }
+
+         if (i != v)
+         {
+            std::cout << "test_fast_convert() - Failed Fast convert 2 "
+                      << " i = " << i
+                      << " v = " << v << std::endl;
+            return false;
+         }
+      }
+   }
+
+   {
+      unsigned int v = 0;
+      for (unsigned int i = 0; i < 1000000000; ++i)
+      {
+         if (!strtk::fast::numeric_convert(strtk::type_to_string(i), v, true))
+         {
+            std::cout << "test_fast_convert() - Failed Fast convert 1  i = " << i << std::endl;
+         }
+
+         if (i != v)
+         {
+            std::cout << "test_fast_convert() - Failed Fast convert 2  "
+                      << "i = " << i
+                      << "v = " << v << std::endl;
+            return false;
+         }
+      }
+   }
+
+   {
+      std::string s[] = {
+                            "0000000000000000",   "1111111111111111",   "2222222222222222",   "3333333333333333",   "4444444444444444",
+                            "5555555555555555",   "6666666666666666",   "1234567890123456",   "9876543210987654",   "1919191919191919",
+                           "00000000000000000",  "11111111111111111",  "22222222222222222",  "33333333333333333",  "44444444444444444",
+                           "55555555555555555",  "66666666666666666",  "12345678901234567",  "98765432109876543",  "19191919191919191",
+                          "000000000000000000", "111111111111111111", "222222222222222222", "333333333333333333", "444444444444444444",
+                          "555555555555555555", "666666666666666666", "123456789012345677", "987654321098765432", "191919191919191919"
+                        };
+
+      unsigned long long v[] = {
+                              0000000000000000LL,   1111111111111111LL,   2222222222222222LL,   3333333333333333LL,   4444444444444444LL,
+                              5555555555555555LL,   6666666666666666LL,   1234567890123456LL,   9876543210987654LL,   1919191919191919LL,
+                             00000000000000000LL,  11111111111111111LL,  22222222222222222LL,  33333333333333333LL,  44444444444444444LL,
+                             55555555555555555LL,  66666666666666666LL,  12345678901234567LL,  98765432109876543LL,  19191919191919191LL,
+                            000000000000000000LL, 111111111111111111LL, 222222222222222222LL, 333333333333333333LL, 444444444444444444LL,
+                            555555555555555555LL, 666666666666666666LL, 123456789012345677LL, 987654321098765432LL, 191919191919191919LL
+                        };
+
+      for (std::size_t i = 0 ; i < (sizeof(s) / sizeof(std::string)); ++i)
+      {
+         unsigned long long t = 0;
+         strtk::fast::numeric_convert(s[i],t);
+         if (t != v[i])
+         {
+            strtk::fast::numeric_convert(s[i],t);
+
+            std::cout << "test_fast_convert() - Failed Fast convert Special Test unsigned long long "
+                      << " index = " << i
+                      << " t = " << t
+                      << " v[index] = " << v[i] << std::endl;
+            return false;
+         }
+      }
+   }
+
+   return true;
+
+}
+
+bool test_double_convert()
+{
+   {
+      static const std::string fract10_str[] =
+                   {
+                      "0.0",
+                      "1.0E+001", "1.0E+002", "1.0E+003", "1.0E+004", "1.0E+005", "1.0E+006", "1.0E+007", "1.0E+008", "1.0E+009", "1.0E+010",
+                      "1.0E+011", "1.0E+012", "1.0E+013", "1.0E+014", "1.0E+015", "1.0E+016", "1.0E+017", "1.0E+018", "1.0E+019", "1.0E+020",
+                      "1.0E+021", "1.0E+022", "1.0E+023", "1.0E+024", "1.0E+025", "1.0E+026", "1.0E+027", "1.0E+028", "1.0E+029", "1.0E+030",
+                      "1.0E+031", "1.0E+032", "1.0E+033", "1.0E+034", "1.0E+035", "1.0E+036", "1.0E+037", "1.0E+038", "1.0E+039", "1.0E+040",
+                      "1.0E+041", "1.0E+042", "1.0E+043", "1.0E+044", "1.0E+045", "1.0E+046", "1.0E+047", "1.0E+048", "1.0E+049", "1.0E+050",
+                      "1.0E+051", "1.0E+052", "1.0E+053", "1.0E+054", "1.0E+055", "1.0E+056", "1.0E+057", "1.0E+058", "1.0E+059", "1.0E+060",
+                      "1.0E+061", "1.0E+062", "1.0E+063", "1.0E+064", "1.0E+065", "1.0E+066", "1.0E+067", "1.0E+068", "1.0E+069", "1.0E+070",
+                      "1.0E+071", "1.0E+072", "1.0E+073", "1.0E+074", "1.0E+075", "1.0E+076", "1.0E+077", "1.0E+078", "1.0E+079", "1.0E+080",
+                      "1.0E+081", "1.0E+082", "1.0E+083", "1.0E+084", "1.0E+085", "1.0E+086", "1.0E+087", "1.0E+088", "1.0E+089", "1.0E+090",
+                      "1.0E+091", "1.0E+092", "1.0E+093", "1.0E+094", "1.0E+095", "1.0E+096", "1.0E+097", "1.0E+098", "1.0E+099", "1.0E+100",
+                      "1.0E+101", "1.0E+102", "1.0E+103", "1.0E+104", "1.0E+105", "1.0E+106", "1.0E+107", "1.0E+108", "1.0E+109", "1.0E+110",
+                      "1.0E+111", "1.0E+112", "1.0E+113", "1.0E+114", "1.0E+115", "1.0E+116", "1.0E+117", "1.0E+118", "1.0E+119", "1.0E+120",
+                      "1.0E+121", "1.0E+122", "1.0E+123", "1.0E+124", "1.0E+125", "1.0E+126", "1.0E+127", "1.0E+128", "1.0E+129", "1.0E+130",
+                      "1.0E+131", "1.0E+132", "1.0E+133", "1.0E+134", "1.0E+135", "1.0E+136", "1.0E+137", "1.0E+138", "1.0E+139", "1.0E+140",
+                      "1.0E+141", "1.0E+142", "1.0E+143", "1.0E+144", "1.0E+145", "1.0E+146", "1.0E+147", "1.0E+148", "1.0E+149", "1.0E+150",
+                      "1.0E+151", "1.0E+152", "1.0E+153", "1.0E+154", "1.0E+155", "1.0E+156", "1.0E+157", "1.0E+158", "1.0E+159", "1.0E+160",
+                      "1.0E+161", "1.0E+162", "1.0E+163", "1.0E+164", "1.0E+165", "1.0E+166", "1.0E+167", "1.0E+168", "1.0E+169", "1.0E+170",
+                      "1.0E+171", "1.0E+172", "1.0E+173", "1.0E+174", "1.0E+175", "1.0E+176", "1.0E+177", "1.0E+178", "1.0E+179", "1.0E+180",
+                      "1.0E+181", "1.0E+182", "1.0E+183", "1.0E+184", "1.0E+185", "1.0E+186", "1.0E+187", "1.0E+188", "1.0E+189", "1.0E+190",
+                      "1.0E+191", "1.0E+192", "1.0E+193", "1.0E+194", "1.0E+195", "1.0E+196", "1.0E+197", "1.0E+198", "1.0E+199", "1.0E+200",
+                      "1.0E+201", "1.0E+202", "1.0E+203", "1.0E+204", "1.0E+205", "1.0E+206", "1.0E+207", "1.0E+208", "1.0E+209", "1.0E+210",
+                      "1.0E+211", "1.0E+212", "1.0E+213", "1.0E+214", "1.0E+215", "1.0E+216", "1.0E+217", "1.0E+218", "1.0E+219", "1.0E+220",
+                      "1.0E+221", "1.0E+222", "1.0E+223", "1.0E+224", "1.0E+225", "1.0E+226", "1.0E+227", "1.0E+228", "1.0E+229", "1.0E+230",
+                      "1.0E+231", "1.0E+232", "1.0E+233", "1.0E+234", "1.0E+235", "1.0E+236", "1.0E+237", "1.0E+238", "1.0E+239", "1.0E+240",
+                      "1.0E+241", "1.0E+242", "1.0E+243", "1.0E+244", "1.0E+245", "1.0E+246", "1.0E+247", "1.0E+248", "1.0E+249", "1.0E+250",
+                      "1.0E+251", "1.0E+252", "1.0E+253", "1.0E+254", "1.0E+255", "1.0E+256", "1.0E+257", "1.0E+258", "1.0E+259", "1.0E+260",
+                      "1.0E+261", "1.0E+262", "1.0E+263", "1.0E+264", "1.0E+265", "1.0E+266", "1.0E+267", "1.0E+268", "1.0E+269", "1.0E+270",
+                      "1.0E+271", "1.0E+272", "1.0E+273", "1.0E+274", "1.0E+275", "1.0E+276", "1.0E+277", "1.0E+278", "1.0E+279", "1.0E+280",
+                      "1.0E+281", "1.0E+282", "1.0E+283", "1.0E+284", "1.0E+285", "1.0E+286", "1.0E+287", "1.0E+288", "1.0E+289", "1.0E+290",
+                      "1.0E+291", "1.0E+292", "1.0E+293", "1.0E+294", "1.0E+295", "1.0E+296", "1.0E+297", "1.0E+298", "1.0E+299", "1.0E+300",
+                      "1.0E+301", "1.0E+302", "1.0E+303", "1.0E+304", "1.0E+305", "1.0E+306", "1.0E+307", "1.0E+308"
+                   };
+
+      const std::size_t dbl_size = sizeof(fract10_str) / sizeof(std::string);
+
+      bool result = true;
+
+      for (std::size_t i = 1; i < dbl_size; ++i)
+      {
+         double d = std::numeric_limits<double>::quiet_NaN();
+
+         if (!strtk::string_to_type_converter(fract10_str[i],d))
+         {
+            std::cout << "test_double_convert() exp10 test convert failure [" << i << "] "
+                      << "str: ["<< fract10_str[i] << "]" << std::endl;
+            result = false;
+         }
+
+         if (not_equal(d,std::pow(10.0,1.0 * i)))
+         {
+            std::cout << "test_double_convert() exp10 test value check failure [" << i << "] "
+                      << "str: ["  << fract10_str[i] << "]  "
+                      << "value: " << d << " "
+                      << "cmpv : " << std::pow(10.0,1.0 * i) << std::endl;
+            result= false;
+         }
+      }
+
+      if (!result)
+         return false;
+   }
+
+   {
+      static const std::string double_str[] =
+                  {
+                       "7379973.6624700",          "+2187496.9290991",            "384281.3720002",
+                     "06603499.49182570",            "-80173.0014819",             "+00693.000285",
+                            "-0.6366299",             "+0.2335175000",               "-00.6366299",
+                        "+00.2335175000",              "-000.6366299",           "+000.2335175000",
+                             "123.456e3",                 "123.456E3",                "123.456e+3",
+                            "123.456E+3",                "123.456e03",                "123.456E03",
+                           "123.456e+03",               "123.456E+03",              "123.456e0003",
+                          "123.456E0003",             "123.456e+0003",             "123.456E+0003",
+                            "123.4560e3",               "123.45600E3",             "123.456000e+3",
+                         "123.456000E+3",            "123.4560000e03",           "123.45600000E03",
+                     "123.456000000e+03",        "123.4560000000E+03",      "123.45600000000e0003",
+                 "123.456000000000E0003",   "123.4560000000000e+0003",  "123.45600000000000E+0003",
+                         "+0123.456e+003",          "-00123.456E+003",           "+000123.45600E3",
+                             "-123.456e3",               "+123.456E3",               "-123.456e+3",
+                            "+123.456E+3",              "-123.456e03",               "+123.456E03",
+                           "-123.456e123",             "+123.456E123",             "-123.456e+123",
+                          "+123.456E+123",            "-123.456e0123",             "+123.456E0123",
+                           "-123.456e+03",             "+123.456E+03",             "-123.456e0003",
+                          "+123.456E0003",           "-123.456e+0003",            "+123.456E+0003",
+                            "-123.4560e3",             "+123.45600E3",            "-123.456000e+3",
+                         "+123.456000E+3",          "-123.4560000e03",          "+123.45600000E03",
+                     "-123.456000000e+03",      "+123.4560000000E+03",     "-123.45600000000e0003",
+                 "+123.456000000000E0003", "-123.4560000000000e+0003", "+123.45600000000000E+0003",
+                         "-0123.456e+003",          "+00123.456E+003",           "-000123.45600E3",
+                   "000000123.456e+0003",                       "0.0",                     "00.00",
+                                "0.0e10",                     "0e+10",                     "0e-10",
+                               "-0.0e10",                     "+0e10",                    "00e010",
+                               "000.000",                 "0000.0000",                     "1234.",
+                                  "01.2",                  "0012.340",               "00012.34500",
+                                     "0",                       "123",                      "0123",
+                                 "00123",                      "-123",                      "+123",
+                       "0",    "1",    "2",    "3",    "4",    "5",    "6",    "7",    "8",    "9",
+                      "+0",   "+1",   "+2",   "+3",   "+4",   "+5",   "+6",   "+7",   "+8",   "+9",
+                      "-0",   "-1",   "-2",   "-3",   "-4",   "-5",   "-6",   "-7",   "-8",   "-9",
+                     "0.0",  "1.0",  "2.0",  "3.0",  "4.0",  "5.0",  "6.0",  "7.0",  "8.0",  "9.0",
+                    "+0.0", "+1.0", "+2.0", "+3.0", "+4.0", "+5.0", "+6.0", "+7.0", "+8.0", "+9.0",
+                    "-0.0", "-1.0", "-2.0", "-3.0", "-4.0", "-5.0", "-6.0", "-7.0", "-8.0", "-9.0",
+           ".0e+0",  ".1e+1",  ".2e+2",  ".3e+3",  ".4e+4",  ".5e+5",  ".6e+6",  ".7e+7",  ".8e+8",  ".9e+9",
+          ".00e+0", ".01e+1", ".02e+2", ".03e+3", ".04e+4", ".05e+5", ".06e+6", ".07e+7", ".08e+8", ".09e+9",
+          ".0e+00", ".1e+01", ".2e+02", ".3e+03", ".4e+04", ".5e+05", ".6e+06", ".7e+07", ".8e+08", ".9e+09",
+           ".0E+0",  ".1E+1",  ".2E+2",  ".3E+3",  ".4E+4",  ".5E+5",  ".6E+6",  ".7E+7",  ".8E+8",  ".9E+9",
+          ".00E+0", ".01E+1", ".02E+2", ".03E+3", ".04E+4", ".05E+5", ".06E+6", ".07E+7", ".08E+8", ".09E+9",
+          ".0E+00", ".1E+01", ".2E+02", ".3E+03", ".4E+04", ".5E+05", ".6E+06", ".7E+07", ".8E+08", ".9E+09",
+          "+.0e+0", "+.1e+1", "+.2e+2", "+.3e+3", "+.4e+4", "+.5e+5", "+.6e+6", "+.7e+7", "+.8e+8", "+.9e+9",
+          "-.0e+0", "-.1e+1", "-.2e+2", "-.3e+3", "-.4e+4", "-.5e+5", "-.6e+6", "-.7e+7", "-.8e+8", "-.9e+9",
+                   "0.",  "1.",  "2.",  "3.",  "4.",  "5.",  "6.",  "7.",  "8.",  "9.",
+                  "+0.", "+1.", "+2.", "+3.", "+4.", "+5.", "+6.", "+7.", "+8.", "+9.",
+                  "-0.", "-1.", "-2.", "-3.", "-4.", "-5.", "-6.", "-7.", "-8.", "-9.",
+                  ".0",  ".1",  ".2",  ".3",  ".4",  ".5",  ".6",  ".7",  ".8",  ".9",
+                  "-.0",  "-.1",  "-.2",  "-.3",  "-.4",  "-.5",  "-.6",  "-.7",  "-.8",  "-.9",
+                  "+.0",  "+.1",  "+.2",  "+.3",  "+.4",  "+.5",  "+.6",  "+.7",  "+.8",  "+.9",
+          "+0.0f", "+1.0f", "+2.0f", "+3.0f", "+4.0f", "+5.0f", "+6.0f", "+7.0f", "+8.0f", "+9.0f",
+          "+0.0F", "+1.0F", "+2.0F", "+3.0F", "+4.0F", "+5.0F", "+6.0F", "+7.0F", "+8.0F", "+9.0F",
+          "+0.0l", "+1.0l", "+2.0l", "+3.0l", "+4.0l", "+5.0l", "+6.0l", "+7.0l", "+8.0l", "+9.0l",
+          "+0.0L", "+1.0L", "+2.0L", "+3.0L", "+4.0L", "+5.0L", "+6.0L", "+7.0L", "+8.0L", "+9.0L",
+          "-0.0f", "-1.0f", "-2.0f", "-3.0f", "-4.0f", "-5.0f", "-6.0f", "-7.0f", "-8.0f", "-9.0f",
+          "-0.0F", "-1.0F", "-2.0F", "-3.0F", "-4.0F", "-5.0F", "-6.0F", "-7.0F", "-8.0F", "-9.0F",
+          "-0.0l", "-1.0l", "-2.0l", "-3.0l", "-4.0l", "-5.0l", "-6.0l", "-7.0l", "-8.0l", "-9.0l",
+          "-0.0L", "-1.0L", "-2.0L", "-3.0L", "-4.0L", "-5.0L", "-6.0L", "-7.0L", "-8.0L", "-9.0L",
+          "+0.0e+1f", "+1.0e+1f", "+2.0e+1f", "+3.0e+1f", "+4.0e+1f", "+5.0e+1f", "+6.0e+1f", "+7.0e+1f", "+8.0e+1f", "+9.0e+1f",
+          "+0.0E-2F", "+1.0E-2F", "+2.0E-2F", "+3.0E-2F", "+4.0E-2F", "+5.0E-2F", "+6.0E-2F", "+7.0E-2F", "+8.0E-2F", "+9.0E-2F",
+          "+0.0e+3l", "+1.0e+3l", "+2.0e+3l", "+3.0e+3l", "+4.0e+3l", "+5.0e+3l", "+6.0e+3l", "+7.0e+3l", "+8.0e+3l", "+9.0e+3l",
+          "+0.0E-4L", "+1.0E-4L", "+2.0E-4L", "+3.0E-4L", "+4.0E-4L", "+5.0E-4L", "+6.0E-4L", "+7.0E-4L", "+8.0E-4L", "+9.0E-4L",
+          "-0.0e+5f", "-1.0e+5f", "-2.0e+5f", "-3.0e+5f", "-4.0e+5f", "-5.0e+5f", "-6.0e+5f", "-7.0e+5f", "-8.0e+5f", "-9.0e+5f",
+          "-0.0E-6F", "-1.0E-6F", "-2.0E-6F", "-3.0E-6F", "-4.0E-6F", "-5.0E-6F", "-6.0E-6F", "-7.0E-6F", "-8.0E-6F", "-9.0E-6F",
+          "-0.0e+7l", "-1.0e+7l", "-2.0e+7l", "-3.0e+7l", "-4.0e+7l", "-5.0e+7l", "-6.0e+7l", "-7.0e+7l", "-8.0e+7l", "-9.0e+7l",
+          "-0.0E-8L", "-1.0E-8L", "-2.0E-8L", "-3.0E-8L", "-4.0E-8L", "-5.0E-8L", "-6.0E-8L", "-7.0E-8L", "-8.0E-8L", "-9.0E-8L",
+         "0.1", "0.01", "0.001", "0.0001", "0.00001", "0.000001", "0.0000001", "0.00000001", "0.000000001",
+         "0.2", "0.02", "0.002", "0.0002", "0.00002", "0.000002", "0.0000002", "0.00000002", "0.000000002",
+         "0.3", "0.03", "0.003", "0.0003", "0.00003", "0.000003", "0.0000003", "0.00000003", "0.000000003",
+         "0.4", "0.04", "0.004", "0.0004", "0.00004", "0.000004", "0.0000004", "0.00000004", "0.000000004",
+         "0.5", "0.05", "0.005", "0.0005", "0.00005", "0.000005", "0.0000005", "0.00000005", "0.000000005",
+         "0.6", "0.06", "0.006", "0.0006", "0.00006", "0.000006", "0.0000006", "0.00000006", "0.000000006",
+         "0.7", "0.07", "0.007", "0.0007", "0.00007", "0.000007", "0.0000007", "0.00000007", "0.000000007",
+         "0.8", "0.08", "0.008", "0.0008", "0.00008", "0.000008", "0.0000008", "0.00000008", "0.000000008",
+         "0.9", "0.09", "0.009", "0.0009", "0.00009", "0.000009", "0.0000009", "0.00000009", "0.000000009",
+         "+0.1", "+0.01", "+0.001", "+0.0001", "+0.00001", "+0.000001", "+0.0000001", "+0.00000001", "+0.000000001",
+         "+0.2", "+0.02", "+0.002", "+0.0002", "+0.00002", "+0.000002", "+0.0000002", "+0.00000002", "+0.000000002",
+         "+0.3", "+0.03", "+0.003", "+0.0003", "+0.00003", "+0.000003", "+0.0000003", "+0.00000003", "+0.000000003",
+         "+0.4", "+0.04", "+0.004", "+0.0004", "+0.00004", "+0.000004", "+0.0000004", "+0.00000004", "+0.000000004",
+         "+0.5", "+0.05", "+0.005", "+0.0005", "+0.00005", "+0.000005", "+0.0000005", "+0.00000005", "+0.000000005",
+         "+0.6", "+0.06", "+0.006", "+0.0006", "+0.00006", "+0.000006", "+0.0000006", "+0.00000006", "+0.000000006",
+         "+0.7", "+0.07", "+0.007", "+0.0007", "+0.00007", "+0.000007", "+0.0000007", "+0.00000007", "+0.000000007",
+         "+0.8", "+0.08", "+0.008", "+0.0008", "+0.00008", "+0.000008", "+0.0000008", "+0.00000008", "+0.000000008",
+         "+0.9", "+0.09", "+0.009", "+0.0009", "+0.00009", "+0.000009", "+0.0000009", "+0.00000009", "+0.000000009",
+         "-0.1", "-0.01", "-0.001", "-0.0001", "-0.00001", "-0.000001", "-0.0000001", "-0.00000001", "-0.000000001",
+         "-0.2", "-0.02", "-0.002", "-0.0002", "-0.00002", "-0.000002", "-0.0000002", "-0.00000002", "-0.000000002",
+         "-0.3", "-0.03", "-0.003", "-0.0003", "-0.00003", "-0.000003", "-0.0000003", "-0.00000003", "-0.000000003",
+         "-0.4", "-0.04", "-0.004", "-0.0004", "-0.00004", "-0.000004", "-0.0000004", "-0.00000004", "-0.000000004",
+         "-0.5", "-0.05", "-0.005", "-0.0005", "-0.00005", "-0.000005", "-0.0000005", "-0.00000005", "-0.000000005",
+         "-0.6", "-0.06", "-0.006", "-0.0006", "-0.00006", "-0.000006", "-0.0000006", "-0.00000006", "-0.000000006",
+         "-0.7", "-0.07", "-0.007", "-0.0007", "-0.00007", "-0.000007", "-0.0000007", "-0.00000007", "-0.000000007",
+         "-0.8", "-0.08", "-0.008", "-0.0008", "-0.00008", "-0.000008", "-0.0000008", "-0.00000008", "-0.000000008",
+         "-0.9", "-0.09", "-0.009", "-0.0009", "-0.00009", "-0.000009", "-0.0000009", "-0.00000009", "-0.000000009",
+                         "1.01", "0.101", "1.0101", "0.10101", "1.010101", "0.1010101", "1.01010101", "1.101010101",
+                         "2.02", "0.202", "2.0202", "0.20202", "2.020202", "0.2020202", "2.02020202", "2.202020202",
+                         "3.03", "0.303", "3.0303", "0.30303", "3.030303", "0.3030303", "3.03030303", "3.303030303",
+                         "4.04", "0.404", "4.0404", "0.40404", "4.040404", "0.4040404", "4.04040404", "4.404040404",
+                         "5.05", "0.505", "5.0505", "0.50505", "5.050505", "0.5050505", "5.05050505", "5.505050505",
+                         "6.06", "0.606", "6.0606", "0.60606", "6.060606", "0.6060606", "6.06060606", "6.606060606",
+                         "7.07", "0.707", "7.0707", "0.70707", "7.070707", "0.7070707", "7.07070707", "7.707070707",
+                         "8.08", "0.808", "8.0808", "0.80808", "8.080808", "0.8080808", "8.08080808", "8.808080808",
+                         "9.09", "0.909", "9.0909", "0.90909", "9.090909", "0.9090909", "9.09090909", "9.909090909",
+                 "+1.01", "+0.101", "+1.0101", "+0.10101", "+1.010101", "+0.1010101", "+1.01010101", "+1.101010101",
+                 "+2.02", "+0.202", "+2.0202", "+0.20202", "+2.020202", "+0.2020202", "+2.02020202", "+2.202020202",
+                 "+3.03", "+0.303", "+3.0303", "+0.30303", "+3.030303", "+0.3030303", "+3.03030303", "+3.303030303",
+                 "+4.04", "+0.404", "+4.0404", "+0.40404", "+4.040404", "+0.4040404", "+4.04040404", "+4.404040404",
+                 "+5.05", "+0.505", "+5.0505", "+0.50505", "+5.050505", "+0.5050505", "+5.05050505", "+5.505050505",
+                 "+6.06", "+0.606", "+6.0606", "+0.60606", "+6.060606", "+0.6060606", "+6.06060606", "+6.606060606",
+                 "+7.07", "+0.707", "+7.0707", "+0.70707", "+7.070707", "+0.7070707", "+7.07070707", "+7.707070707",
+                 "+8.08", "+0.808", "+8.0808", "+0.80808", "+8.080808", "+0.8080808", "+8.08080808", "+8.808080808",
+                 "+9.09", "+0.909", "+9.0909", "+0.90909", "+9.090909", "+0.9090909", "+9.09090909", "+9.909090909",
+                 "-1.01", "-0.101", "-1.0101", "-0.10101", "-1.010101", "-0.1010101", "-1.01010101", "-1.101010101",
+                 "-2.02", "-0.202", "-2.0202", "-0.20202", "-2.020202", "-0.2020202", "-2.02020202", "-2.202020202",
+                 "-3.03", "-0.303", "-3.0303", "-0.30303", "-3.030303", "-0.3030303", "-3.03030303", "-3.303030303",
+                 "-4.04", "-0.404", "-4.0404", "-0.40404", "-4.040404", "-0.4040404", "-4.04040404", "-4.404040404",
+                 "-5.05", "-0.505", "-5.0505", "-0.50505", "-5.050505", "-0.5050505", "-5.05050505", "-5.505050505",
+                 "-6.06", "-0.606", "-6.0606", "-0.60606", "-6.060606", "-0.6060606", "-6.06060606", "-6.606060606",
+                 "-7.07", "-0.707", "-7.0707", "-0.70707", "-7.070707", "-0.7070707", "-7.07070707", "-7.707070707",
+                 "-8.08", "-0.808", "-8.0808", "-0.80808", "-8.080808", "-0.8080808", "-8.08080808", "-8.808080808",
+                 "-9.09", "-0.909", "-9.0909", "-0.90909", "-9.090909", "-0.9090909", "-9.09090909", "-9.909090909",
+                  "+inf",         "-inf",
+                  "+INF",         "-INF",
+                  "+1.0#inf", "-1.0#inf",
+                  "+1.0#INF", "-1.0#INF",
+                  "+infinity",         "-infinity",
+                  "+INFINITY",         "-INFINITY",
+                  "+1.0#infinity", "-1.0#infinity",
+                  "+1.0#INFINITY", "-1.0#INFINITY",
+                       "NAN",    "nan",
+                   "1.0#NAN", "1.0#nan"
+                  };
+
+      static const double d[] =
+                  {
+                        7379973.6624700,          +2187496.9290991,            384281.3720002,
+                      06603499.49182570,            -80173.0014819,             +00693.000285,
+                             -0.6366299,             +0.2335175000,               -00.6366299,
+                         +00.2335175000,              -000.6366299,           +000.2335175000,
+                              123.456e3,                 123.456E3,                123.456e+3,
+                             123.456E+3,                123.456e03,                123.456E03,
+                            123.456e+03,               123.456E+03,              123.456e0003,
+                           123.456E0003,             123.456e+0003,             123.456E+0003,
+                             123.4560e3,               123.45600E3,             123.456000e+3,
+                          123.456000E+3,            123.4560000e03,           123.45600000E03,
+                      123.456000000e+03,        123.4560000000E+03,      123.45600000000e0003,
+                  123.456000000000E0003,   123.4560000000000e+0003,  123.45600000000000E+0003,
+                          +0123.456e+003,          -00123.456E+003,           +000123.45600E3,
+                              -123.456e3,               +123.456E3,               -123.456e+3,
+                             +123.456E+3,              -123.456e03,               +123.456E03,
+                            -123.456e123,             +123.456E123,             -123.456e+123,
+                           +123.456E+123,            -123.456e0123,             +123.456E0123,
+                            -123.456e+03,             +123.456E+03,             -123.456e0003,
+                           +123.456E0003,           -123.456e+0003,            +123.456E+0003,
+                             -123.4560e3,             +123.45600E3,            -123.456000e+3,
+                          +123.456000E+3,          -123.4560000e03,          +123.45600000E03,
+                      -123.456000000e+03,      +123.4560000000E+03,     -123.45600000000e0003,
+                  +123.456000000000E0003, -123.4560000000000e+0003, +123.45600000000000E+0003,
+                           -123.456e+003,            +123.456E+003,              -123.45600E3,
+                           123.456e+0003,                      0.0,                       0.0,
+                                     0.0,                      0.0,                       0.0,
+                                     0.0,                      0.0,                       0.0,
+                                     0.0,                      0.0,                     1234.,
+                                     1.2,                    12.34,                  12.34500,
+                                       0,                      123,                       123,
+                                     123,                     -123,                      +123,
+                                    0.0,  1.0,  2.0,  3.0,  4.0,  5.0,  6.0,  7.0,  8.0,  9.0,
+                                   +0.0, +1.0, +2.0, +3.0, +4.0, +5.0, +6.0, +7.0, +8.0, +9.0,
+                                   -0.0, -1.0, -2.0, -3.0, -4.0, -5.0, -6.0, -7.0, -8.0, -9.0,
+                                    0.0,  1.0,  2.0,  3.0,  4.0,  5.0,  6.0,  7.0,  8.0,  9.0,
+                                   +0.0, +1.0, +2.0, +3.0, +4.0, +5.0, +6.0, +7.0, +8.0, +9.0,
+                                   -0.0, -1.0, -2.0, -3.0, -4.0, -5.0, -6.0, -7.0, -8.0, -9.0,
+                 .0e+0,  .1e+1,  .2e+2,  .3e+3,  .4e+4,  .5e+5,  .6e+6,  .7e+7,  .8e+8,  .9e+9,
+                .00e+0, .01e+1, .02e+2, .03e+3, .04e+4, .05e+5, .06e+6, .07e+7, .08e+8, .09e+9,
+                .0e+00, .1e+01, .2e+02, .3e+03, .4e+04, .5e+05, .6e+06, .7e+07, .8e+08, .9e+09,
+                 .0E+0,  .1E+1,  .2E+2,  .3E+3,  .4E+4,  .5E+5,  .6E+6,  .7E+7,  .8E+8,  .9E+9,
+                .00E+0, .01E+1, .02E+2, .03E+3, .04E+4, .05E+5, .06E+6, .07E+7, .08E+8, .09E+9,
+                .0E+00, .1E+01, .2E+02, .3E+03, .4E+04, .5E+05, .6E+06, .7E+07, .8E+08, .9E+09,
+                +.0e+0, +.1e+1, +.2e+2, +.3e+3, +.4e+4, +.5e+5, +.6e+6, +.7e+7, +.8e+8, +.9e+9,
+                -.0e+0, -.1e+1, -.2e+2, -.3e+3, -.4e+4, -.5e+5, -.6e+6, -.7e+7, -.8e+8, -.9e+9,
+                                     0.0,  1.0,  2.0,  3.0,  4.0,  5.0,  6.0,  7.0,  8.0,  9.0,
+                                    +0.0, +1.0, +2.0, +3.0, +4.0, +5.0, +6.0, +7.0, +8.0, +9.0,
+                                    -0.0, -1.0, -2.0, -3.0, -4.0, -5.0, -6.0, -7.0, -8.0, -9.0,
+                            0.0,   0.1,   0.2,   0.3,   0.4,   0.5 ,  0.6,   0.7,   0.8,   0.9,
+                           -0.0,  -0.1,  -0.2,  -0.3,  -0.4,  -0.5,  -0.6,  -0.7,  -0.8,  -0.9,
+                           +0.0,  +0.1,  +0.2,  +0.3,  +0.4,  +0.5,  +0.6,  +0.7,  +0.8,  +0.9,
+                                    +0.0, +1.0, +2.0, +3.0, +4.0, +5.0, +6.0, +7.0, +8.0, +9.0,
+                                    +0.0, +1.0, +2.0, +3.0, +4.0, +5.0, +6.0, +7.0, +8.0, +9.0,
+                                    +0.0, +1.0, +2.0, +3.0, +4.0, +5.0, +6.0, +7.0, +8.0, +9.0,
+                                    +0.0, +1.0, +2.0, +3.0, +4.0, +5.0, +6.0, +7.0, +8.0, +9.0,
+                                    -0.0, -1.0, -2.0, -3.0, -4.0, -5.0, -6.0, -7.0, -8.0, -9.0,
+                                    -0.0, -1.0, -2.0, -3.0, -4.0, -5.0, -6.0, -7.0, -8.0, -9.0,
+                                    -0.0, -1.0, -2.0, -3.0, -4.0, -5.0, -6.0, -7.0, -8.0, -9.0,
+                                    -0.0, -1.0, -2.0, -3.0, -4.0, -5.0, -6.0, -7.0, -8.0, -9.0,
+      +0.0e+1, +1.0e+1, +2.0e+1, +3.0e+1, +4.0e+1, +5.0e+1, +6.0e+1, +7.0e+1, +8.0e+1, +9.0e+1,
+      +0.0E-2, +1.0E-2, +2.0E-2, +3.0E-2, +4.0E-2, +5.0E-2, +6.0E-2, +7.0E-2, +8.0E-2, +9.0E-2,
+      +0.0e+3, +1.0e+3, +2.0e+3, +3.0e+3, +4.0e+3, +5.0e+3, +6.0e+3, +7.0e+3, +8.0e+3, +9.0e+3,
+      +0.0E-4, +1.0E-4, +2.0E-4, +3.0E-4, +4.0E-4, +5.0E-4, +6.0E-4, +7.0E-4, +8.0E-4, +9.0E-4,
+      -0.0e+5, -1.0e+5, -2.0e+5, -3.0e+5, -4.0e+5, -5.0e+5, -6.0e+5, -7.0e+5, -8.0e+5, -9.0e+5,
+      -0.0E-6, -1.0E-6, -2.0E-6, -3.0E-6, -4.0E-6, -5.0E-6, -6.0E-6, -7.0E-6, -8.0E-6, -9.0E-6,
+      -0.0e+7, -1.0e+7, -2.0e+7, -3.0e+7, -4.0e+7, -5.0e+7, -6.0e+7, -7.0e+7, -8.0e+7, -9.0e+7,
+      -0.0E-8, -1.0E-8, -2.0E-8, -3.0E-8, -4.0E-8, -5.0E-8, -6.0E-8, -7.0E-8, -8.0E-8, -9.0E-8,
+               0.1, 0.01, 0.001, 0.0001, 0.00001, 0.000001, 0.0000001, 0.00000001, 0.000000001,
+               0.2, 0.02, 0.002, 0.0002, 0.00002, 0.000002, 0.0000002, 0.00000002, 0.000000002,
+               0.3, 0.03, 0.003, 0.0003, 0.00003, 0.000003, 0.0000003, 0.00000003, 0.000000003,
+               0.4, 0.04, 0.004, 0.0004, 0.00004, 0.000004, 0.0000004, 0.00000004, 0.000000004,
+               0.5, 0.05, 0.005, 0.0005, 0.00005, 0.000005, 0.0000005, 0.00000005, 0.000000005,
+               0.6, 0.06, 0.006, 0.0006, 0.00006, 0.000006, 0.0000006, 0.00000006, 0.000000006,
+               0.7, 0.07, 0.007, 0.0007, 0.00007, 0.000007, 0.0000007, 0.00000007, 0.000000007,
+               0.8, 0.08, 0.008, 0.0008, 0.00008, 0.000008, 0.0000008, 0.00000008, 0.000000008,
+               0.9, 0.09, 0.009, 0.0009, 0.00009, 0.000009, 0.0000009, 0.00000009, 0.000000009,
+      +0.1, +0.01, +0.001, +0.0001, +0.00001, +0.000001, +0.0000001, +0.00000001, +0.000000001,
+      +0.2, +0.02, +0.002, +0.0002, +0.00002, +0.000002, +0.0000002, +0.00000002, +0.000000002,
+      +0.3, +0.03, +0.003, +0.0003, +0.00003, +0.000003, +0.0000003, +0.00000003, +0.000000003,
+      +0.4, +0.04, +0.004, +0.0004, +0.00004, +0.000004, +0.0000004, +0.00000004, +0.000000004,
+      +0.5, +0.05, +0.005, +0.0005, +0.00005, +0.000005, +0.0000005, +0.00000005, +0.000000005,
+      +0.6, +0.06, +0.006, +0.0006, +0.00006, +0.000006, +0.0000006, +0.00000006, +0.000000006,
+      +0.7, +0.07, +0.007, +0.0007, +0.00007, +0.000007, +0.0000007, +0.00000007, +0.000000007,
+      +0.8, +0.08, +0.008, +0.0008, +0.00008, +0.000008, +0.0000008, +0.00000008, +0.000000008,
+      +0.9, +0.09, +0.009, +0.0009, +0.00009, +0.000009, +0.0000009, +0.00000009, +0.000000009,
+      -0.1, -0.01, -0.001, -0.0001, -0.00001, -0.000001, -0.0000001, -0.00000001, -0.000000001,
+      -0.2, -0.02, -0.002, -0.0002, -0.00002, -0.000002, -0.0000002, -0.00000002, -0.000000002,
+      -0.3, -0.03, -0.003, -0.0003, -0.00003, -0.000003, -0.0000003, -0.00000003, -0.000000003,
+      -0.4, -0.04, -0.004, -0.0004, -0.00004, -0.000004, -0.0000004, -0.00000004, -0.000000004,
+      -0.5, -0.05, -0.005, -0.0005, -0.00005, -0.000005, -0.0000005, -0.00000005, -0.000000005,
+      -0.6, -0.06, -0.006, -0.0006, -0.00006, -0.000006, -0.0000006, -0.00000006, -0.000000006,
+      -0.7, -0.07, -0.007, -0.0007, -0.00007, -0.000007, -0.0000007, -0.00000007, -0.000000007,
+      -0.8, -0.08, -0.008, -0.0008, -0.00008, -0.000008, -0.0000008, -0.00000008, -0.000000008,
+      -0.9, -0.09, -0.009, -0.0009, -0.00009, -0.000009, -0.0000009, -0.00000009, -0.000000009,
+                    1.01, 0.101, 1.0101, 0.10101, 1.010101, 0.1010101, 1.01010101, 1.101010101,
+                    2.02, 0.202, 2.0202, 0.20202, 2.020202, 0.2020202, 2.02020202, 2.202020202,
+                    3.03, 0.303, 3.0303, 0.30303, 3.030303, 0.3030303, 3.03030303, 3.303030303,
+                    4.04, 0.404, 4.0404, 0.40404, 4.040404, 0.4040404, 4.04040404, 4.404040404,
+                    5.05, 0.505, 5.0505, 0.50505, 5.050505, 0.5050505, 5.05050505, 5.505050505,
+                    6.06, 0.606, 6.0606, 0.60606, 6.060606, 0.6060606, 6.06060606, 6.606060606,
+                    7.07, 0.707, 7.0707, 0.70707, 7.070707, 0.7070707, 7.07070707, 7.707070707,
+                    8.08, 0.808, 8.0808, 0.80808, 8.080808, 0.8080808, 8.08080808, 8.808080808,
+                    9.09, 0.909, 9.0909, 0.90909, 9.090909, 0.9090909, 9.09090909, 9.909090909,
+            +1.01, +0.101, +1.0101, +0.10101, +1.010101, +0.1010101, +1.01010101, +1.101010101,
+            +2.02, +0.202, +2.0202, +0.20202, +2.020202, +0.2020202, +2.02020202, +2.202020202,
+            +3.03, +0.303, +3.0303, +0.30303, +3.030303, +0.3030303, +3.03030303, +3.303030303,
+            +4.04, +0.404, +4.0404, +0.40404, +4.040404, +0.4040404, +4.04040404, +4.404040404,
+            +5.05, +0.505, +5.0505, +0.50505, +5.050505, +0.5050505, +5.05050505, +5.505050505,
+            +6.06, +0.606, +6.0606, +0.60606, +6.060606, +0.6060606, +6.06060606, +6.606060606,
+            +7.07, +0.707, +7.0707, +0.70707, +7.070707, +0.7070707, +7.07070707, +7.707070707,
+            +8.08, +0.808, +8.0808, +0.80808, +8.080808, +0.8080808, +8.08080808, +8.808080808,
+            +9.09, +0.909, +9.0909, +0.90909, +9.090909, +0.9090909, +9.09090909, +9.909090909,
+            -1.01, -0.101, -1.0101, -0.10101, -1.010101, -0.1010101, -1.01010101, -1.101010101,
+            -2.02, -0.202, -2.0202, -0.20202, -2.020202, -0.2020202, -2.02020202, -2.202020202,
+            -3.03, -0.303, -3.0303, -0.30303, -3.030303, -0.3030303, -3.03030303, -3.303030303,
+            -4.04, -0.404, -4.0404, -0.40404, -4.040404, -0.4040404, -4.04040404, -4.404040404,
+            -5.05, -0.505, -5.0505, -0.50505, -5.050505, -0.5050505, -5.05050505, -5.505050505,
+            -6.06, -0.606, -6.0606, -0.60606, -6.060606, -0.6060606, -6.06060606, -6.606060606,
+            -7.07, -0.707, -7.0707, -0.70707, -7.070707, -0.7070707, -7.07070707, -7.707070707,
+            -8.08, -0.808, -8.0808, -0.80808, -8.080808, -0.8080808, -8.08080808, -8.808080808,
+            -9.09, -0.909, -9.0909, -0.90909, -9.090909, -0.9090909, -9.09090909, -9.909090909,
+            +std::numeric_limits<double>::infinity(), -std::numeric_limits<double>::infinity(),
+            +std::numeric_limits<double>::infinity(), -std::numeric_limits<double>::infinity(),
+            +std::numeric_limits<double>::infinity(), -std::numeric_limits<double>::infinity(),
+            +std::numeric_limits<double>::infinity(), -std::numeric_limits<double>::infinity(),
+            +std::numeric_limits<double>::infinity(), -std::numeric_limits<double>::infinity(),
+            +std::numeric_limits<double>::infinity(), -std::numeric_limits<double>::infinity(),
+            +std::numeric_limits<double>::infinity(), -std::numeric_limits<double>::infinity(),
+            +std::numeric_limits<double>::infinity(), -std::numeric_limits<double>::infinity(),
+             std::numeric_limits<double>::quiet_NaN(), std::numeric_limits<double>::quiet_NaN(),
+             std::numeric_limits<double>::quiet_NaN(), std::numeric_limits<double>::quiet_NaN(),
+           };
+
+      static const std::size_t d_size = sizeof(double_str) / sizeof(std::string);
+
+      double v = 0.0;
+      for (std::size_t i = 0; i < d_size; ++i)
+      {
+         v = 0.0;
+
+         if (!strtk::string_to_type_converter(double_str[i],v))
+         {
+            std::cout << "test_double_convert() double convert[" << i << "]"
+                      << " dblstr: [" << double_str[i] << "]" << std::endl;
+            return false;
+         }
+
+         if (not_equal(d[i],v) && (!strtk_isnan(v)))
+         {
+            std::cout << "test_double_convert() double check[" << i << "]"
+                      << " dblstr: [" << double_str[i] << "]" << std::endl;
+            return false;
+         }
+      }
+
+      static const std::string bad_list[] =
+                          {
+                             "1234567.8A",      "1234567.A",      "12345A67.8",      "A1234567.8A",
+                            "1234567.8Ae", "1234567.AE+100", "12345A67.8e+100", "A1234567.8AE+100",
+                            "--1.234e+10",    "++1.234e+10",      "1.234e+10-",       "1.234e+10+",
+                             "1.234e++10",     "1.234E--10",         "1.e++10",          "1.E--10",
+                             "1..234e+10",     "1.23.4E-10",      "1.234e-1.0",            "1.23x",
+                             "1.23e+100y",               "",            "123+",             "123-",
+                                  "123.+",          "123.-",           "123+.",            "123-.",
+                               "123..123",       "123.-123",        "123.+123",           "123-.0",
+                                                             "+", "-", "+.", "-.", ".+", ".-", ".",
+                                                      "++", "--", "++.", "--.", ".++", ".--", "..",
+                                                      "+f", "-f", "+.f", "-.f", ".+f", ".-f", ".f",
+                                                      "+l", "-l", "+.l", "-.l", ".+l", ".-l", ".l",
+                              ".+0", ".+1", ".+2", ".+3", ".+4", ".+5", ".+6", ".+7", ".+8", ".+9",
+                              ".-0", ".-1", ".-2", ".-3", ".-4", ".-5", ".-6", ".-7", ".-8", ".-9",
+                    "..+0", "..+1", "..+2", "..+3", "..+4", "..+5", "..+6", "..+7", "..+8", "..+9",
+                    "..-0", "..-1", "..-2", "..-3", "..-4", "..-5", "..-6", "..-7", "..-8", "..-9",
+                    ".+0f", ".+1F", ".+2f", ".+3F", ".+4f", ".+5F", ".+6f", ".+7F", ".+8f", ".+9F",
+                    ".-0l", ".-1L", ".-2l", ".-3L", ".-4l", ".-5L", ".-6l", ".-7L", ".-8l", ".-9L"
+                          };
+
+      static const std::size_t bad_list_size = sizeof(bad_list) / sizeof(std::string);
+
+      for (std::size_t i = 0; i < bad_list_size; ++i)
+      {
+         if (strtk::string_to_type_converter(bad_list[i],v))
+         {
+            std::cout << "test_double_convert() bad test failure [" << i << "]  - [" << bad_list[i] << "]" << std::endl;
+            return false;
+         }
+      }
+   }
+
+   {
+      static const std::size_t count = 10000000;
+      std::string s;
+      s.reserve(32);
+      double t = 0.0;
+
+      for (int i = -static_cast<int>(count); i < static_cast<int>(count); ++i)
+      {
+         if (!strtk::type_to_string(i,s))
+         {
+            std::cout << "test_double_convert() - Failed int to string @ " << i << std::endl;
+            return false;
+         }
+
+         if (!strtk::string_to_type_converter(s,t))
+         {
+            std::cout << "test_double_convert() - Failed string to double @ " << i << std::endl;
+            return false;
+         }
+
+         if (static_cast<double>(i) != t)
+         {
+            std::cout << "test_double_convert() - Failed i == t @ " << i << std::endl;
+            return false;
+         }
+
+         s.clear();
+      }
+   }
+
+   {
+      std::string s;
+      s.reserve(256);
+
+      double v = -111111.11;
+      double t = 0.0;
+
+      while (v < +111111.11)
+      {
+         std_double_to_string(v,s);
+
+         if (!strtk::string_to_type_converter(s,t))
+         {
+            std::cout << "test_double_convert() - Failed decimal to string,  t: " << t << std::endl;
+            return false;
+         }
+
+         if (not_equal(t,v,0.0000000001))
+         {
+            std::cout << "test_double_convert() - Failed decimal r == t  r: " << t << std::endl;
+            return false;
+         }
+
+         v += 0.01;
+         s.clear();
+         t = 0.0;
+      }
+   }
+
+   {
+      double d1 = +123.456;
+      double d2 = -123.456;
+      double delta[] =
+             {
+               0.333,   0.555,   0.777,
+               0.999, 0.13579, 0.97531
+             };
+      std::size_t delta_size = sizeof(delta) / sizeof(double);
+
+      std::string s;
+      s.reserve(256);
+      double tmp = 0.0;
+
+      for (int i = 0; i < 1000000; ++i)
+      {
+         std_double_to_string(d1,s);
+
+         if (!strtk::string_to_type_converter(s,tmp))
+         {
+            std::cout << "test_double_convert() - (1) final test string to double failure @ " << i << std::endl;
+            return false;
+         }
+
+         if (not_equal(d1,tmp,0.000000001))
+         {
+            std::cout << "test_double_convert() - (1) final test compare failure @ " << i << std::endl;
+            return false;
+         }
+
+         d1 += delta[std::abs(i) % delta_size];
+
+         std_double_to_string(d2,s);
+
+         if (!strtk::string_to_type_converter(s,tmp))
+         {
+            std::cout << "test_double_convert() - (2) final test string to double failure @ " << i << std::endl;
+            return false;
+         }
+
+         if (not_equal(d2,tmp,0.000000001))
+         {
+            std::cout << "test_double_convert() - (2) final test compare failure @ " << i << std::endl;
+            return false;
+         }
+
+         d2 -= delta[std::abs(i) % delta_size];
+      }
+   }
+
+   {
+      static const std::string dbl_str_list[] =
+                                  {
+                                     "0.0",
+                                     "1.0E+001", "1.0E+002", "1.0E+003", "1.0E+004", "1.0E+005", "1.0E+006", "1.0E+007", "1.0E+008", "1.0E+009", "1.0E+010",
+                                     "1.0E+011", "1.0E+012", "1.0E+013", "1.0E+014", "1.0E+015", "1.0E+016", "1.0E+017", "1.0E+018", "1.0E+019", "1.0E+020",
+                                     "1.0E+021", "1.0E+022", "1.0E+023", "1.0E+024", "1.0E+025", "1.0E+026", "1.0E+027", "1.0E+028", "1.0E+029", "1.0E+030",
+                                     "1.0E+031", "1.0E+032", "1.0E+033", "1.0E+034", "1.0E+035", "1.0E+036", "1.0E+037", "1.0E+038", "1.0E+039", "1.0E+040",
+                                     "1.0E+041", "1.0E+042", "1.0E+043", "1.0E+044", "1.0E+045", "1.0E+046", "1.0E+047", "1.0E+048", "1.0E+049", "1.0E+050",
+                                     "1.0E+051", "1.0E+052", "1.0E+053", "1.0E+054", "1.0E+055", "1.0E+056", "1.0E+057", "1.0E+058", "1.0E+059", "1.0E+060",
+                                     "1.0E+061", "1.0E+062", "1.0E+063", "1.0E+064", "1.0E+065", "1.0E+066", "1.0E+067", "1.0E+068", "1.0E+069", "1.0E+070",
+                                     "1.0E+071", "1.0E+072", "1.0E+073", "1.0E+074", "1.0E+075", "1.0E+076", "1.0E+077", "1.0E+078", "1.0E+079", "1.0E+080",
+                                     "1.0E+081", "1.0E+082", "1.0E+083", "1.0E+084", "1.0E+085", "1.0E+086", "1.0E+087", "1.0E+088", "1.0E+089", "1.0E+090",
+                                     "1.0E+091", "1.0E+092", "1.0E+093", "1.0E+094", "1.0E+095", "1.0E+096", "1.0E+097", "1.0E+098", "1.0E+099", "1.0E+100",
+                                     "1.0E+101", "1.0E+102", "1.0E+103", "1.0E+104", "1.0E+105", "1.0E+106", "1.0E+107", "1.0E+108", "1.0E+109", "1.0E+110",
+                                     "1.0E+111", "1.0E+112", "1.0E+113", "1.0E+114", "1.0E+115", "1.0E+116", "1.0E+117", "1.0E+118", "1.0E+119", "1.0E+120",
+                                     "1.0E+121", "1.0E+122", "1.0E+123", "1.0E+124", "1.0E+125", "1.0E+126", "1.0E+127", "1.0E+128", "1.0E+129", "1.0E+130",
+                                     "1.0E+131", "1.0E+132", "1.0E+133", "1.0E+134", "1.0E+135", "1.0E+136", "1.0E+137", "1.0E+138", "1.0E+139", "1.0E+140",
+                                     "1.0E+141", "1.0E+142", "1.0E+143", "1.0E+144", "1.0E+145", "1.0E+146", "1.0E+147", "1.0E+148", "1.0E+149", "1.0E+150",
+                                     "1.0E+151", "1.0E+152", "1.0E+153", "1.0E+154", "1.0E+155", "1.0E+156", "1.0E+157", "1.0E+158", "1.0E+159", "1.0E+160",
+                                     "1.0E+161", "1.0E+162", "1.0E+163", "1.0E+164", "1.0E+165", "1.0E+166", "1.0E+167", "1.0E+168", "1.0E+169", "1.0E+170",
+                                     "1.0E+171", "1.0E+172", "1.0E+173", "1.0E+174", "1.0E+175", "1.0E+176", "1.0E+177", "1.0E+178", "1.0E+179", "1.0E+180",
+                                     "1.0E+181", "1.0E+182", "1.0E+183", "1.0E+184", "1.0E+185", "1.0E+186", "1.0E+187", "1.0E+188", "1.0E+189", "1.0E+190",
+                                     "1.0E+191", "1.0E+192", "1.0E+193", "1.0E+194", "1.0E+195", "1.0E+196", "1.0E+197", "1.0E+198", "1.0E+199", "1.0E+200",
+                                     "1.0E+201", "1.0E+202", "1.0E+203", "1.0E+204", "1.0E+205", "1.0E+206", "1.0E+207", "1.0E+208", "1.0E+209", "1.0E+210",
+                                     "1.0E+211", "1.0E+212", "1.0E+213", "1.0E+214", "1.0E+215", "1.0E+216", "1.0E+217", "1.0E+218", "1.0E+219", "1.0E+220",
+                                     "1.0E+221", "1.0E+222", "1.0E+223", "1.0E+224", "1.0E+225", "1.0E+226", "1.0E+227", "1.0E+228", "1.0E+229", "1.0E+230",
+                                     "1.0E+231", "1.0E+232", "1.0E+233", "1.0E+234", "1.0E+235", "1.0E+236", "1.0E+237", "1.0E+238", "1.0E+239", "1.0E+240",
+                                     "1.0E+241", "1.0E+242", "1.0E+243", "1.0E+244", "1.0E+245", "1.0E+246", "1.0E+247", "1.0E+248", "1.0E+249", "1.0E+250",
+                                     "1.0E+251", "1.0E+252", "1.0E+253", "1.0E+254", "1.0E+255", "1.0E+256", "1.0E+257", "1.0E+258", "1.0E+259", "1.0E+260",
+                                     "1.0E+261", "1.0E+262", "1.0E+263", "1.0E+264", "1.0E+265", "1.0E+266", "1.0E+267", "1.0E+268", "1.0E+269", "1.0E+270",
+                                     "1.0E+271", "1.0E+272", "1.0E+273", "1.0E+274", "1.0E+275", "1.0E+276", "1.0E+277", "1.0E+278", "1.0E+279", "1.0E+280",
+                                     "1.0E+281", "1.0E+282", "1.0E+283", "1.0E+284", "1.0E+285", "1.0E+286", "1.0E+287", "1.0E+288", "1.0E+289", "1.0E+290",
+                                     "1.0E+291", "1.0E+292", "1.0E+293", "1.0E+294", "1.0E+295", "1.0E+296", "1.0E+297", "1.0E+298", "1.0E+299", "1.0E+300",
+                                     "1.0E+301", "1.0E+302", "1.0E+303", "1.0E+304", "1.0E+305", "1.0E+306", "1.0E+307", "1.0E+308"
+                                  };
+      static const std::size_t dbl_str_list_size = sizeof(dbl_str_list) / sizeof(std::string);
+
+      static const double dbl_list[] =
+                                  {
+                                     0.0,
+                                     1.0E+001, 1.0E+002, 1.0E+003, 1.0E+004, 1.0E+005, 1.0E+006, 1.0E+007, 1.0E+008, 1.0E+009, 1.0E+010,
+                                     1.0E+011, 1.0E+012, 1.0E+013, 1.0E+014, 1.0E+015, 1.0E+016, 1.0E+017, 1.0E+018, 1.0E+019, 1.0E+020,
+                                     1.0E+021, 1.0E+022, 1.0E+023, 1.0E+024, 1.0E+025, 1.0E+026, 1.0E+027, 1.0E+028, 1.0E+029, 1.0E+030,
+                                     1.0E+031, 1.0E+032, 1.0E+033, 1.0E+034, 1.0E+035, 1.0E+036, 1.0E+037, 1.0E+038, 1.0E+039, 1.0E+040,
+                                     1.0E+041, 1.0E+042, 1.0E+043, 1.0E+044, 1.0E+045, 1.0E+046, 1.0E+047, 1.0E+048, 1.0E+049, 1.0E+050,
+                                     1.0E+051, 1.0E+052, 1.0E+053, 1.0E+054, 1.0E+055, 1.0E+056, 1.0E+057, 1.0E+058, 1.0E+059, 1.0E+060,
+                                     1.0E+061, 1.0E+062, 1.0E+063, 1.0E+064, 1.0E+065, 1.0E+066, 1.0E+067, 1.0E+068, 1.0E+069, 1.0E+070,
+                                     1.0E+071, 1.0E+072, 1.0E+073, 1.0E+074, 1.0E+075, 1.0E+076, 1.0E+077, 1.0E+078, 1.0E+079, 1.0E+080,
+                                     1.0E+081, 1.0E+082, 1.0E+083, 1.0E+084, 1.0E+085, 1.0E+086, 1.0E+087, 1.0E+088, 1.0E+089, 1.0E+090,
+                                     1.0E+091, 1.0E+092, 1.0E+093, 1.0E+094, 1.0E+095, 1.0E+096, 1.0E+097, 1.0E+098, 1.0E+099, 1.0E+100,
+                                     1.0E+101, 1.0E+102, 1.0E+103, 1.0E+104, 1.0E+105, 1.0E+106, 1.0E+107, 1.0E+108, 1.0E+109, 1.0E+110,
+                                     1.0E+111, 1.0E+112, 1.0E+113, 1.0E+114, 1.0E+115, 1.0E+116, 1.0E+117, 1.0E+118, 1.0E+119, 1.0E+120,
+                                     1.0E+121, 1.0E+122, 1.0E+123, 1.0E+124, 1.0E+125, 1.0E+126, 1.0E+127, 1.0E+128, 1.0E+129, 1.0E+130,
+                                     1.0E+131, 1.0E+132, 1.0E+133, 1.0E+134, 1.0E+135, 1.0E+136, 1.0E+137, 1.0E+138, 1.0E+139, 1.0E+140,
+                                     1.0E+141, 1.0E+142, 1.0E+143, 1.0E+144, 1.0E+145, 1.0E+146, 1.0E+147, 1.0E+148, 1.0E+149, 1.0E+150,
+                                     1.0E+151, 1.0E+152, 1.0E+153, 1.0E+154, 1.0E+155, 1.0E+156, 1.0E+157, 1.0E+158, 1.0E+159, 1.0E+160,
+                                     1.0E+161, 1.0E+162, 1.0E+163, 1.0E+164, 1.0E+165, 1.0E+166, 1.0E+167, 1.0E+168, 1.0E+169, 1.0E+170,
+                                     1.0E+171, 1.0E+172, 1.0E+173, 1.0E+174, 1.0E+175, 1.0E+176, 1.0E+177, 1.0E+178, 1.0E+179, 1.0E+180,
+                                     1.0E+181, 1.0E+182, 1.0E+183, 1.0E+184, 1.0E+185, 1.0E+186, 1.0E+187, 1.0E+188, 1.0E+189, 1.0E+190,
+                                     1.0E+191, 1.0E+192, 1.0E+193, 1.0E+194, 1.0E+195, 1.0E+196, 1.0E+197, 1.0E+198, 1.0E+199, 1.0E+200,
+                                     1.0E+201, 1.0E+202, 1.0E+203, 1.0E+204, 1.0E+205, 1.0E+206, 1.0E+207, 1.0E+208, 1.0E+209, 1.0E+210,
+                                     1.0E+211, 1.0E+212, 1.0E+213, 1.0E+214, 1.0E+215, 1.0E+216, 1.0E+217, 1.0E+218, 1.0E+219, 1.0E+220,
+                                     1.0E+221, 1.0E+222, 1.0E+223, 1.0E+224, 1.0E+225, 1.0E+226, 1.0E+227, 1.0E+228, 1.0E+229, 1.0E+230,
+                                     1.0E+231, 1.0E+232, 1.0E+233, 1.0E+234, 1.0E+235, 1.0E+236, 1.0E+237, 1.0E+238, 1.0E+239, 1.0E+240,
+                                     1.0E+241, 1.0E+242, 1.0E+243, 1.0E+244, 1.0E+245, 1.0E+246, 1.0E+247, 1.0E+248, 1.0E+249, 1.0E+250,
+                                     1.0E+251, 1.0E+252, 1.0E+253, 1.0E+254, 1.0E+255, 1.0E+256, 1.0E+257, 1.0E+258, 1.0E+259, 1.0E+260,
+                                     1.0E+261, 1.0E+262, 1.0E+263, 1.0E+264, 1.0E+265, 1.0E+266, 1.0E+267, 1.0E+268, 1.0E+269, 1.0E+270,
+                                     1.0E+271, 1.0E+272, 1.0E+273, 1.0E+274, 1.0E+275, 1.0E+276, 1.0E+277, 1.0E+278, 1.0E+279, 1.0E+280,
+                                     1.0E+281, 1.0E+282, 1.0E+283, 1.0E+284, 1.0E+285, 1.0E+286, 1.0E+287, 1.0E+288, 1.0E+289, 1.0E+290,
+                                     1.0E+291, 1.0E+292, 1.0E+293, 1.0E+294, 1.0E+295, 1.0E+296, 1.0E+297, 1.0E+298, 1.0E+299, 1.0E+300,
+                                     1.0E+301, 1.0E+302, 1.0E+303, 1.0E+304, 1.0E+305, 1.0E+306, 1.0E+307, 1.0E+308
+                                  };
+
+      for (std::size_t i = 0; i < dbl_str_list_size; ++i)
+      {
+         double d = std::numeric_limits<double>::quiet_NaN();
+
+         if (!strtk::string_to_type_converter(dbl_str_list[i],d))
+         {
+            std::cout << "test_double_convert() - Failed frac-table string to double: " << dbl_str_list[i] << std::endl;
+            return false;
+         }
+
+         if (not_equal(dbl_list[i],d,0.0000000001))
+         {
+            std::cout << "test_double_convert() - Failed frac-table i == d: " << dbl_str_list[i] << std::endl;
+            return false;
+         }
+      }
+   }
+
+   return true;
+}
+
+bool test_double_convert_exact()
+{
+   #ifdef strtk_enable_exact_real
+   // Cases requiring correct rounding, checked bitwise against the compiler
+   static const std::string double_str[] =
+                  {
+                     "0.1", "0.3", "1.7976931348623157e308", "2.2250738585072011e-308",
+                     "2.2250738585072012e-308", "4.9406564584124654e-324", "2.4703282292062328e-324",
+                     "9007199254740993", "9007199254740993.0000000000000000000001", "9007199254740995",
+                     "1.00000000000000011102230246251565404236316680908203125",
+                     "1.00000000000000011102230246251565404236316680908203126",
+                     "1.00000000000000033306690738754696212708950042724609375",
+                     "7.2057594037927933e16", "123456789012345678901234567890", "8.98846567431158e307",
+                     "0.000000000000000000000000000000000000000000001e-279", "1e-400", "1e400",
+                     "3.14159265358979323846264338327950288419716939937510582097494459",
+                     "1448997445238699", "9.109383701528e-31", "6.02214076e23", "0.0000000000000000000000000000001"
+                  };
+
+   static const double d[] =
+                  {
+                      0.1, 0.3, 1.7976931348623157e308, 2.2250738585072011e-308,
+                      2.2250738585072012e-308, 4.9406564584124654e-324, 2.4703282292062328e-324,
+                      9007199254740993.0, 9007199254740993.0000000000000000000001, 9007199254740995.0,
+                      1.00000000000000011102230246251565404236316680908203125,
+                      1.00000000000000011102230246251565404236316680908203126,
+                      1.00000000000000033306690738754696212708950042724609375,
+                      7.2057594037927933e16, 123456789012345678901234567890.0, 8.98846567431158e307,
+                      0.0, 0.0, std::numeric_limits<double>::infinity(),
+                      3.14159265358979323846264338327950288419716939937510582097494459,
+                      1448997445238699.0, 9.109383701528e-31, 6.02214076e23, 0.0000000000000000000000000000001
+                  };
+
+   static const std::size_t double_str_size = sizeof(double_str) / sizeof(std::string);
+
+   for (std::size_t i = 0; i < double_str_size; ++i)
+   {
+      double v = 0.0;
+
+      if (!strtk::string_to_type_converter(double_str[i],v) || (0 != std::memcmp(&v,&d[i],sizeof(double))))
+      {
+         std::cout << "test_double_convert_exact() - Failed double [" << i << "] str: " << double_str[i] << std::endl;
+         return false;
+      }
+   }
+
+   static const std::string float_str[] =
+                  {
+                     "0.1", "3.4028235e38", "1.17549435e-38", "1.4e-45", "16777217",
+                     "16777217.000000000000000000000000001", "0.71e-45", "1.00000005960464477539062499"
+                  };
+
+   static const float f[] =
+                  {
+                     0.1f, 3.4028235e38f, 1.17549435e-38f, 1.4e-45f, 16777217.0f,
+                     16777217.000000000000000000000000001f, 1.4e-45f, 1.00000005960464477539062499f
+                  };
+
+   static const std::size_t float_str_size = sizeof(float_str) / sizeof(std::string);
+
+   for (std::size_t i = 0; i < float_str_size; ++i)
+   {
+      float v = 0.0f;
+
+      if (!strtk::string_to_type_converter(float_str[i],v) || (0 != std::memcmp(&v,&f[i],sizeof(float))))
+      {
+         std::cout << "test_double_convert_exact() - Failed float [" << i << "] str: " << float_str[i] << std::endl;
+         return false;
+      }
+   }
+
+   static const std::string long_double_str[] =
+                  {
+                     "0.1", "1e28", "1.5e-300", "123456789012345678901234567890", "9.109383701528e-31",
+                     "3.14159265358979323846264338327950288419716939937510582097494459",
+                     "1.18973149535723176502e4932", "1.18973149535723176509e4932", "3.6451995318824746025e-4951",
+                     "1.82259976594123730126420296680970990819952540784678167186049024351418584431669886840478035431291361e-4951",
+                     "1e-4960", "6.02214076e23", "0.000000000000000000000000000000000000000123456789012345678901"
+                  };
+
+   static const long double ld[] =
+                  {
+                     0.1L, 1e28L, 1.5e-300L, 123456789012345678901234567890.0L, 9.109383701528e-31L,
+                     3.14159265358979323846264338327950288419716939937510582097494459L,
+                     1.18973149535723176502e4932L, std::numeric_limits<long double>::infinity(), 3.6451995318824746025e-4951L,
+                     1.82259976594123730126420296680970990819952540784678167186049024351418584431669886840478035431291361e-4951L,
+                     0.0L, 6.02214076e23L, 0.000000000000000000000000000000000000000123456789012345678901L
+                  };
+
+   static const std::size_t long_double_str_size = sizeof(long_double_str) / sizeof(std::string);
+
+   for (std::size_t i = 0; (64 == std::numeric_limits<long double>::digits) && (i < long_double_str_size); ++i)
+   {
+      long double v = 0.0L;
+
+      if (!strtk::string_to_type_converter(long_double_str[i],v) || (v != ld[i]))
+      {
+         std::cout << "test_double_convert_exact() - Failed long double [" << i << "] str: " << long_double_str[i] << std::endl;
+         return false;
+      }
+   }
+   #endif
+
+   return true;
+}
+
+bool test_construct_and_parse()
+{
+   data_block i;
+   std::string output = "";
+   i.d1  = "The quick brown fox jumps over the lazy dog";
+   i.d2  = 'x';
+   i.d3  = -1234;
+   i.d4  = 78901;
+   i.d5  = 4567.8901;
+   i.d6  = 123.456f;
+   i.d7  = -16000;
+   i.d8  = 15000;
+   i.d9  = true;
+   i.d10 = 0xEE;
+
+   strtk::construct(output, "|", i.d1, i.d2, i.d3, i.d4, i.d5, i.d6, i.d7, i.d8, i.d9, i.d10);
+   data_block o = i;
+
+   bool result = true;
+
+   o.clear(1);
+   result = strtk::parse(output, "|", o.d1);
+
+   if (!result || (o != i))
+   {
+      std::cout << "test_construct_and_parse() - parse fail 1" << std::endl;
+      return false;
+   }
+
+   o.clear(2);
+   result = strtk::parse(output, "|", o.d1, o.d2);
+
+   if (!result || (o != i))
+   {
+      std::cout << "test_construct_and_parse() - parse fail 2" << std::endl;
+      return false;
+   }
+
+   o.clear(3);
+   result = strtk::parse(output, "|", o.d1, o.d2, o.d3);
+
+   if (!result || (o != i))
+   {
+      std::cout << "test_construct_and_parse() - parse fail 3" << std::endl;
+      return false;
+   }
+
+   o.clear(4);
+   result = strtk::parse(output, "|", o.d1, o.d2, o.d3, o.d4);
+
+   if (!result || (o != i))
+   {
+      std::cout << "test_construct_and_parse() - parse fail 4" << std::endl;
+      return false;
+   }
+
+   o.clear(5);
+   result = strtk::parse(output, "|", o.d1, o.d2, o.d3, o.d4, o.d5);
+
+   if (!result || (o != i))
+   {
+      std::cout << "test_construct_and_parse() - parse fail 5" << std::endl;
+      return false;
+   }
+
+   o.clear(6);
+   result = strtk::parse(output, "|", o.d1, o.d2, o.d3, o.d4, o.d5, o.d6);
+
+   if (!result || (o != i))
+   {
+      std::cout << "test_construct_and_parse() - parse fail 6" << std::endl;
+      return false;
+   }
+
+   o.clear(7);
+   result = strtk::parse(output, "|", o.d1, o.d2, o.d3, o.d4, o.d5, o.d6, o.d7);
+
+   if (!result || (o != i))
+   {
+      std::cout << "test_construct_and_parse() - parse fail 7" << std::endl;
+      return false;
+   }
+
+   o.clear(8);
+   result = strtk::parse(output, "|", o.d1, o.d2, o.d3, o.d4, o.d5, o.d6, o.d7, o.d8);
+
+   if (!result || (o != i))
+   {
+      std::cout << "test_construct_and_parse() - parse fail 8" << std::endl;
+      return false;
+   }
+
+   o.clear(9);
+   result = strtk::parse(output, "|", o.d1, o.d2, o.d3, o.d4, o.d5, o.d6, o.d7, o.d8, o.d9);
+
+   if (!result || (o != i))
+   {
+      std::cout << "test_construct_and_parse() - parse fail 9" << std::endl;
+      return false;
+   }
+
+   o.clear(10);
+   result = strtk::parse(output, "|", o.d1, o.d2, o.d3, o.d4, o.d5, o.d6, o.d7, o.d8, o.d9, o.d10);
+
+   if (!result || (o != i))
+   {
+      std::cout << "test_construct_and_parse() - parse fail 10" << std::endl;
+      return false;
+   }
+
+   return true;
+}
+
+bool test_int_uint_convert()
+{
+   static const std::size_t count = 20000000;
+   std::string s;
+   s.reserve(32);
+
+   {
+      const std::string test_str[] =
+      {
+         "0",
+         "1",
+         "12",
+         "123",
+         "1234",
+         "12345",
+         "123456",
+         "1234567",
+         "12345678",
+         "123456789",
+         "-0",
+         "-1",
+         "-12",
+         "-123",
+         "-1234",
+         "-12345",
+         "-123456",
+         "-1234567",
+         "-12345678",
+         "-123456789",
+         "-2147483574"
+      };
+
+      const int test_int[] =
+      {
+         0,
+         1,
+         12,
+         123,
+         1234,
+         12345,
+         123456,
+         1234567,
+         12345678,
+         123456789,
+         -0,
+         -1,
+         -12,
+         -123,
+         -1234,
+         -12345,
+         -123456,
+         -1234567,
+         -12345678,
+         -123456789,
+         -2147483574
+      };
+
+      for (std::size_t i = 0; i < sizeof(test_str) / sizeof(std::string); ++i)
+      {
+         int t = 9999999;
+
+         if (!strtk::string_to_type_converter(test_str[i],t))
+         {
+            std::cout << "test_int_uint_convert() - Failed basic string to int @ " << i << std::endl;
+            return false;
+         }
+
+         if (test_int[i] != t)
+         {
+            std::cout << "test_int_uint_convert() - Failed basic (int) i == t @ " << i << std::endl;
+            return false;
+         }
+      }
+
+   }
+
+   {
+      int t = 0;
+
+      for (int i = -static_cast<int>(count); i < static_cast<int>(count); ++i)
+      {
+         if (!strtk::type_to_string(i,s))
+         {
+            std::cout << "test_int_uint_convert() - Failed int to string @ " << i << std::endl;
+            return false;
+         }
+
+         if (!strtk::string_to_type_converter(s,t))
+         {
+            std::cout << "test_int_uint_convert() - Failed string to int @ " << i << std::endl;
+            return false;
+         }
+
+         if (i != t)
+         {
+            std::cout << "test_int_uint_convert() - Failed (int) i == t @ " << i << std::endl;
+            return false;
+         }
+
+         s.clear();
+      }
+   }
+
+   {
+      unsigned int t = 0;
+
+      for (unsigned int i = 0; i < (2 * count); ++i)
+      {
+         if (!strtk::type_to_string(i,s))
+         {
+            std::cout << "test_int_uint_convert() - Failed uint to string @ " << i << std::endl;
+            return false;
+         }
+
+         if (!strtk::string_to_type_converter(s,t))
+         {
+            std::cout << "test_int_uint_convert() - Failed string to uint @ " << i << std::endl;
+            return false;
+         }
+
+         if (i != t)
+         {
+            std::cout << "test_int_uint_convert() - Failed (uint) i == t @ " << i << std::endl;
+            return false;
+         }
+
+         s.clear();
+      }
+   }
+
+   static const std::string bad_list[]
+                = {
+                     "12345678901",            "+12345678901",
+                     "123456789012",           "+123456789012",
+                     "1234567890123",          "+1234567890123",
+                     "12345678901234",         "+12345678901234",
+                     "123456789012345",        "+123456789012345",
+                     "00000123456789012345",   "+00000123456789012345",
+                     "12345678901234500000",   "+12345678901234500000",
+                     "1234A",                  "+1234A",
+                     "12A34",                  "+12A34",
+                     "A1234",                  "+A1234",
+                     "-12345678901",           "012345678901",
+                     "-123456789012",          "00123456789012",
+                     "-1234567890123",         "0001234567890123",
+                     "-12345678901234",        "00012345678901234",
+                     "-123456789012345",       "000123456789012345",
+                     "-00000123456789012345",  "-012345678901",
+                     "-12345678901234500000",  "-00123456789012",
+                     "-1234A",                 "-0001234567890123",
+                     "-12A34",                 "-00012345678901234",
+                     "-A1234",                 "-000123456789012345",
+                     "+012345678901",
+                     "+00123456789012",
+                     "+0001234567890123",
+                     "+00012345678901234",
+                     "+000123456789012345",
+                     "+", "-", "+-", "-+", ""
+                  };
+   static const std::size_t bad_list_size = sizeof(bad_list) / sizeof(std::string);
+
+   {
+      int t = 0;
+
+      for (std::size_t i = 0; i < bad_list_size; ++i)
+      {
+         if (strtk::string_to_type_converter(bad_list[i],t))
+         {
+            std::cout << "test_int_uint_convert() - Failed bad test for int @ " << i
+                      << " str: [" << bad_list[i] << "]" << std::endl;
+
+            return false;
+         }
+      }
+   }
+
+   {
+      unsigned int t = 0;
+
+      for (std::size_t i = 0; i < bad_list_size; ++i)
+      {
+         if (strtk::string_to_type_converter(bad_list[i],t))
+         {
+            std::cout << "test_int_uint_convert() - Failed bad test for uint @ " << i
+                      << " str: [" << bad_list[i] << "]" << std::endl;
+
+            return false;
+         }
+      }
+   }
+
+   {
+      short t = 0;
+
+      for (std::size_t i = 0; i < bad_list_size; ++i)
+      {
+         if (strtk::string_to_type_converter(bad_list[i],t))
+         {
+            std::cout << "test_int_uint_convert() - Failed bad test for short @ " << i
+                      << " str: [" << bad_list[i] << "]" << std::endl;
+
+            return false;
+         }
+      }
+   }
+
+   {
+      unsigned short t = 0;
+
+      for (std::size_t i = 0; i < bad_list_size; ++i)
+      {
+         if (strtk::string_to_type_converter(bad_list[i],t))
+         {
+            std::cout << "test_int_uint_convert() - Failed bad test for ushort @ " << i
+                      << " str: [" << bad_list[i] << "]" << std::endl;
+
+            return false;
+         }
+      }
+   }
+
+   {
+      const short int min_shrtint = std::numeric_limits<short int>::min();
+      const int       min_int     = std::numeric_limits<int      >::min();
+      const long long min_lnglng  = std::numeric_limits<long long>::min();
+
+      const std::string min_shrtint_str = "-32768";
+      const std::string min_int_str     = "-2147483648";
+      const std::string min_lnglng_str  = "-9223372036854775808";
+
+      if (min_shrtint_str != strtk::type_to_string(min_shrtint))
+      {
+         std::cout << "test_int_uint_convert() - Failed min short int to string conversion!  result:" << strtk::type_to_string(min_shrtint) << std::endl;
+         return false;
+      }
+
+      if (min_int_str != strtk::type_to_string(min_int))
+      {
+         std::cout << "test_int_uint_convert() - Failed min int to string conversion!  result:" << strtk::type_to_string(min_int) << std::endl;
+         return false;
+      }
+
+      if (min_lnglng_str != strtk::type_to_string(min_lnglng))
+      {
+         std::cout << "test_int_uint_convert() - Failed min long long to string conversion!  result:" << strtk::type_to_string(min_lnglng) << std::endl;
+         return false;
+      }
+   }
+
+   {
+      const short int          max_shrtint  = std::numeric_limits<short int         >::max();
+      const unsigned short int max_ushrtint = std::numeric_limits<unsigned short int>::max();
+      const int                max_int      = std::numeric_limits<int               >::max();
+      const unsigned int       max_uint     = std::numeric_limits<unsigned int      >::max();
+      const long long          max_lnglng   = std::numeric_limits<long long         >::max();
+      const unsigned long long max_ulnglng  = std::numeric_limits<unsigned long long>::max();
+
+      const std::string max_shrtint_str  =                "32767";
+      const std::string max_ushrtint_str =                "65535";
+      const std::string max_int_str      =           "2147483647";
+      const std::string max_uint_str     =           "4294967295";
+      const std::string max_lnglng_str   =  "9223372036854775807";
+      const std::string max_ulnglng_str  = "18446744073709551615";
+
+      if (max_shrtint_str != strtk::type_to_string(max_shrtint))
+      {
+         std::cout << "test_int_uint_convert() - Failed max short int to string conversion! [1]  result:" << strtk::type_to_string(max_shrtint) << std::endl;
+         return false;
+      }
+
+      if (max_ushrtint_str != strtk::type_to_string(max_ushrtint))
+      {
+         std::cout << "test_int_uint_convert() - Failed max unsigned short int to string conversion! [1]  result:" << strtk::type_to_string(max_ushrtint) << std::endl;
+         return false;
+      }
+
+      if (max_int_str != strtk::type_to_string(max_int))
+      {
+         std::cout << "test_int_uint_convert() - Failed max int to string conversion! [1]  result:" << strtk::type_to_string(max_int) << std::endl;
+         return false;
+      }
+
+      if (max_uint_str != strtk::type_to_string(max_uint))
+      {
+         std::cout << "test_int_uint_convert() - Failed max uint to string conversion! [1]  result:" << strtk::type_to_string(max_uint) << std::endl;
+         return false;
+      }
+
+      if (max_lnglng_str != strtk::type_to_string(max_lnglng))
+      {
+         std::cout << "test_int_uint_convert() - Failed max long long to string conversion! [1]  result:" << strtk::type_to_string(max_lnglng) << std::endl;
+         return false;
+      }
+
+      if (max_ulnglng_str != strtk::type_to_string(max_ulnglng))
+      {
+         std::cout << "test_int_uint_convert() - Failed max long long to string conversion! [1]  result:" << strtk::type_to_string(max_ulnglng) << std::endl;
+         return false;
+      }
+
+      if (max_shrtint != strtk::string_to_type_converter<short int>(max_shrtint_str))
+      {
+         std::cout << "test_int_uint_convert() - Failed string to max short int conversion! [1]  result:" << strtk::string_to_type_converter<short int>(max_shrtint_str) << std::endl;
+         return false;
+      }
+
+      if (max_ushrtint != strtk::string_to_type_converter<unsigned short int>(max_ushrtint_str))
+      {
+         std::cout << "test_int_uint_convert() - Failed string to max short int conversion! [1]  result:" << strtk::string_to_type_converter<unsigned short int>(max_ushrtint_str) << std::endl;
+         return false;
+      }
+
+      if (max_int != strtk::string_to_type_converter<int>(max_int_str))
+      {
+         std::cout << "test_int_uint_convert() - Failed string to max int conversion! [1]  result:" << strtk::string_to_type_converter<int>(max_int_str) << std::endl;
+         return false;
+      }
+
+      if (max_uint != strtk::string_to_type_converter<unsigned int>(max_uint_str))
+      {
+         std::cout << "test_int_uint_convert() - Failed string to max uint conversion! [1]  result:" << strtk::string_to_type_converter<unsigned int>(max_uint_str) << std::endl;
+         return false;
+      }
+
+      if (max_lnglng != strtk::string_to_type_converter<long long>(max_lnglng_str))
+      {
+         std::cout << "test_int_uint_convert() - Failed string to max long long conversion! [1]  result:" << strtk::string_to_type_converter<long long>(max_lnglng_str) << std::endl;
+         return false;
+      }
+
+      if (max_ulnglng != strtk::string_to_type_converter<unsigned long long>(max_ulnglng_str))
+      {
+         std::cout << "test_int_uint_convert() - Failed string to max long long conversion! [1]  result:" << strtk::string_to_type_converter<unsigned long long>(max_ulnglng_str) << std::endl;
+         return false;
+      }
+   }
+
+   {
+      const short int min_shrtint  = std::numeric_limits<short int>::min();
+      const int       min_int      = std::numeric_limits<int      >::min();
+      const long long min_lnglng   = std::numeric_limits<long long>::min();
+
+      const std::string min_shrtint_str  =               "-32768";
+      const std::string min_int_str      =          "-2147483648";
+      const std::string min_lnglng_str   = "-9223372036854775808";
+
+      if (min_shrtint_str != strtk::type_to_string(min_shrtint))
+      {
+         std::cout << "test_int_uint_convert() - Failed min short int to string conversion! [1]  result:" << strtk::type_to_string(min_shrtint) << std::endl;
+         return false;
+      }
+
+      if (min_int_str != strtk::type_to_string(min_int))
+      {
+         std::cout << "test_int_uint_convert() - Failed min int to string conversion! [1]  result:" << strtk::type_to_string(min_int) << std::endl;
+         return false;
+      }
+
+      if (min_lnglng_str != strtk::type_to_string(min_lnglng))
+      {
+         std::cout << "test_int_uint_convert() - Failed min long long to string conversion! [1]  result:" << strtk::type_to_string(min_lnglng) << std::endl;
+         return false;
+      }
+
+      if (min_shrtint != strtk::string_to_type_converter<short int>(min_shrtint_str))
+      {
+         std::cout << "test_int_uint_convert() - Failed string to min short int conversion! [1]  result:" << strtk::string_to_type_converter<short int>(min_shrtint_str) << std::endl;
+         return false;
+      }
+
+      if (min_int != strtk::string_to_type_converter<int>(min_int_str))
+      {
+         std::cout << "test_int_uint_convert() - Failed string to min int conversion! [1]  result:" << strtk::string_to_type_converter<int>(min_int_str) << std::endl;
+         return false;
+      }
+
+      if (min_lnglng != strtk::string_to_type_converter<long long>(min_lnglng_str))
+      {
+         std::cout << "test_int_uint_convert() - Failed string to min long long conversion! [1]  result:" << strtk::string_to_type_converter<long long>(min_lnglng_str) << std::endl;
+         return false;
+      }
+   }
+
+   {
+      std::string s1 =  "65536";
+      std::string s2 = "+65536";
+      std::string s3 =  "99999";
+      unsigned short t = 0;
+
+      if (strtk::string_to_type_converter(s1,t))
+      {
+         std::cout << "test_int_uint_convert() - Failed bad test for max1 ushort str: " << s << std::endl;
+         return false;
+      }
+
+      if (strtk::string_to_type_converter(s2,t))
+      {
+         std::cout << "test_int_uint_convert() - Failed bad test for max2 ushort str: " << s << std::endl;
+         return false;
+      }
+
+      if (strtk::string_to_type_converter(s3,t))
+      {
+         std::cout << "test_int_uint_convert() - Failed bad test for extreme ushort str: " << s << std::endl;
+         return false;
+      }
+   }
+
+   {
+      std::string s1 = "-32769";
+      std::string s2 = "+32768";
+      std::string s3 =  "32768";
+      std::string s4 =  "99999";
+      short int t = 0;
+
+      if (strtk::string_to_type_converter(s1,t))
+      {
+         std::cout << "test_int_uint_convert() - Failed bad test for min short str: " << s << std::endl;
+         return false;
+      }
+
+      if (strtk::string_to_type_converter(s2,t))
+      {
+         std::cout << "test_int_uint_convert() - Failed bad test for max1 short str: " << s << std::endl;
+         return false;
+      }
+
+      if (strtk::string_to_type_converter(s3,t))
+      {
+         std::cout << "test_int_uint_convert() - Failed bad test for max2 short str: " << s << std::endl;
+         return false;
+      }
+
+      if (strtk::string_to_type_converter(s4,t))
+      {
+         std::cout << "test_int_uint_convert() - Failed bad test for extreme short str: " << s << std::endl;
+         return false;
+      }
+   }
+
+   {
+      std::string s1 =  "4294967296";
+      std::string s2 = "+4294967296";
+      std::string s3 =  "9999999999";
+      unsigned int t = 0;
+
+      if (strtk::string_to_type_converter(s1,t))
+      {
+         std::cout << "test_int_uint_convert() - Failed bad test for max1 uint str: " << s << std::endl;
+         return false;
+      }
+
+      if (strtk::string_to_type_converter(s2,t))
+      {
+         std::cout << "test_int_uint_convert() - Failed bad test for max2 uint str: " << s << std::endl;
+         return false;
+      }
+
+      if (strtk::string_to_type_converter(s3,t))
+      {
+         std::cout << "test_int_uint_convert() - Failed bad test for extreme uint str: " << s << std::endl;
+         return false;
+      }
+   }
+
+   {
+      std::string s1 = "-2147483649";
+      std::string s2 = "+2147483648";
+      std::string s3 =  "2147483648";
+      std::string s4 =  "9999999999";
+      int t = 0;
+
+      if (strtk::string_to_type_converter(s1,t))
+      {
+         std::cout << "test_int_uint_convert() - Failed bad test for min int str: " << s1 << std::endl;
+         return false;
+      }
+
+      if (strtk::string_to_type_converter(s2,t))
+      {
+         std::cout << "test_int_uint_convert() - Failed bad test for max1 int str: " << s2 << std::endl;
+         return false;
+      }
+
+      if (strtk::string_to_type_converter(s3,t))
+      {
+         std::cout << "test_int_uint_convert() - Failed bad test for max2 int str: " << s3 << std::endl;
+         return false;
+      }
+
+      if (strtk::string_to_type_converter(s4,t))
+      {
+         std::cout << "test_int_uint_convert() - Failed bad test for extreme int str: " << s4 << std::endl;
+         return false;
+      }
+   }
+
+   {
+      std::string s1 = "-0009223372036854775809";
+      std::string s2 = "+0009223372036854775808";
+      std::string s3 =  "0009223372036854775808";
+      std::string s4 =  "0009999999999999999999";
+
+      long long t = 0;
+
+      if (strtk::string_to_type_converter(s1,t))
+      {
+         std::cout << "test_int_uint_convert() - Failed bad test for min long long str: " << s1 << std::endl;
+         return false;
+      }
+
+      if (strtk::string_to_type_converter(s2,t))
+      {
+         std::cout << "test_int_uint_convert() - Failed bad test for max1 long long str: " << s2 << std::endl;
+         return false;
+      }
+
+      if (strtk::string_to_type_converter(s3,t))
+      {
+         std::cout << "test_int_uint_convert() - Failed bad test for max2 long long str: " << s3 << std::endl;
+         return false;
+      }
+
+      if (strtk::string_to_type_converter(s4,t))
+      {
+         std::cout << "test_int_uint_convert() - Failed bad test for extreme long long str: " << s4 << std::endl;
+         return false;
+      }
+   }
+
+   {
+      std::string s1 = "-00018446744073709551616";
+      std::string s2 = "+00018446744073709551616";
+      std::string s3 =  "00018446744073709551616";
+      std::string s4 =  "00099999999999999999999";
+
+      unsigned long long t = 0;
+
+      if (strtk::string_to_type_converter(s1,t))
+      {
+         std::cout << "test_int_uint_convert() - Failed bad test for min unsigned long long str: " << s1 << std::endl;
+         return false;
+      }
+
+      if (strtk::string_to_type_converter(s2,t))
+      {
+         std::cout << "test_int_uint_convert() - Failed bad test for max1 unsigned long long str: " << s2 << std::endl;
+         return false;
+      }
+
+      if (strtk::string_to_type_converter(s3,t))
+      {
+         std::cout << "test_int_uint_convert() - Failed bad test for max2 unsigned long long str: " << s3 << std::endl;
+         return false;
+      }
+
+      if (strtk::string_to_type_converter(s4,t))
+      {
+         std::cout << "test_int_uint_convert() - Failed bad test for extreme unsigned long long str: " << s4 << std::endl;
+         return false;
+      }
+   }
+
+   return true;
+}
+
+bool test_parse1()
+{
+   std::string data = "1 ,|\t987.654 ,|\t abc ,|\t";
+   int i = 0;
+   double d = 0;
+   std::string s;
+
+   if (!strtk::parse(data, ",|\t ", i, d, s))
+   {
+      std::cout << "test_parse() - parse fail 1" << std::endl;
+      return false;
+   }
+
+   if ((i != 1) || (d != 987.654) || (s != "abc"))
+   {
+      std::cout << "test_parse() - parse fail 2" << std::endl;
+      return false;
+   }
+
+   return true;
+}
+
+bool test_parse2()
+{
+   std::string data = "1 ,|\t2. ,|\t 3.3 ,|\t .4 ,|\t 123.456 ,|\t 3.30 ,|\t 1.0e+010 ,|\t 2.2e+11 ,|\t 3.0E+012 ,|\t 4.4E+13";
+
+   double d[10] = { 0.0 };
+
+   if (!strtk::parse(data, ",|\t ", d[0], d[1], d[2], d[3], d[4], d[5], d[6], d[7], d[8], d[9]))
+   {
+      std::cout << "test_parse2() - parse double fail" << std::endl;
+      return false;
+   }
+
+   if (not_equal(d[0],      1.0)) { std::cout << "test_parse2() double check0 " << std::endl; return false; }
+   if (not_equal(d[1],      2.0)) { std::cout << "test_parse2() double check1 " << std::endl; return false; }
+   if (not_equal(d[2],      3.3)) { std::cout << "test_parse2() double check2 " << std::endl; return false; }
+   if (not_equal(d[3],      0.4)) { std::cout << "test_parse2() double check3 " << std::endl; return false; }
+   if (not_equal(d[4],  123.456)) { std::cout << "test_parse2() double check4 " << std::endl; return false; }
+   if (not_equal(d[5],      3.3)) { std::cout << "test_parse2() double check5 " << std::endl; return false; }
+   if (not_equal(d[6], 1.0e+010)) { std::cout << "test_parse2() double check6 " << std::endl; return false; }
+   if (not_equal(d[7], 2.2e+011)) { std::cout << "test_parse2() double check7 " << std::endl; return false; }
+   if (not_equal(d[8], 3.0e+012)) { std::cout << "test_parse2() double check8 " << std::endl; return false; }
+   if (not_equal(d[9], 4.4e+013)) { std::cout << "test_parse2() double check9 " << std::endl; return false; }
+
+   float f[10]  = { 0.0 };
+
+   if (!strtk::parse(data, ",|\t ", f[0], f[1], f[2], f[3], f[4], f[5], f[6], f[7], f[8], f[9]))
+   {
+      std::cout << "test_parse2() - parse float fail" << std::endl;
+      return false;
+   }
+
+   if (not_equal(f[0],      1.0f)) { std::cout << "test_parse2() float check0 " << std::endl; return false; }
+   if (not_equal(f[1],      2.0f)) { std::cout << "test_parse2() float check1 " << std::endl; return false; }
+   if (not_equal(f[2],      3.3f)) { std::cout << "test_parse2() float check2 " << std::endl; return false; }
+   if (not_equal(f[3],      0.4f)) { std::cout << "test_parse2() float check3 " << std::endl; return false; }
+   if (not_equal(f[4],  123.456f)) { std::cout << "test_parse2() float check4 " << std::endl; return false; }
+   if (not_equal(f[5],      3.3f)) { std::cout << "test_parse2() float check5 " << std::endl; return false; }
+   if (not_equal(f[6], 1.0e+010f)) { std::cout << "test_parse2() float check6 " << std::endl; return false; }
+   if (not_equal(f[7], 2.2e+011f)) { std::cout << "test_parse2() float check7 " << std::endl; return false; }
+   if (not_equal(f[8], 3.0e+012f)) { std::cout << "test_parse2() float check8 " << std::endl; return false; }
+   if (not_equal(f[9], 4.4e+013f)) { std::cout << "test_parse2() float check9 " << std::endl; return false; }
+
+   return true;
+}
+
+bool test_parse3()
+{
+
+   std::string data = "123.456e3,123.456E3 123.456e+3,123.456E+3 123.456e03              "
+                      "123.456E03, 123.456e+03 123.456E+03,123.456e0003|123.456E0003,    "
+                      "123.456e+0003 123.456E+0003,|123.4560e3 123.45600E3, 123.456000e+3"
+                      "123.456000E+3,|123.4560000e03 123.45600000E03, 123.456000000e+03  "
+                      "123.4560000000E+03,123.45600000000e0003|123.456000000000E0003,    "
+                      "123.4560000000000e+0003 123.45600000000000E+0003                  "
+                      "0123.456e+003 00123.456E+003,| 000123.45600E3, 000000123.456e+0003";
+
+   std::vector<double> double_list;
+
+   bool result = true;
+
+   if (!strtk::parse(data,",|\t ",double_list))
+   {
+      std::cout << "test_parse2() - parse double fail" << std::endl;
+      return false;
+   }
+
+   for (std::size_t i = 0; i < double_list.size(); ++i)
+   {
+      if (123.456e3 != double_list[i])
+      {
+         std::cout << "test_parse3() double check[" << i << "] ";
+         printf("value: %30.20f\n",double_list[i]);
+         result = false;
+      }
+   }
+
+   std::vector<float> float_list;
+
+   if (!strtk::parse(data,",|\t ",float_list))
+   {
+      std::cout << "test_parse3() - parse float fail." << std::endl;
+      result = false;
+   }
+
+   for (std::size_t i = 0; i < float_list.size(); ++i)
+   {
+      if (123.456e3f != float_list[i])
+      {
+         std::cout << "test_parse3() float check[" << i << "] ";
+         printf("value: %20.10f\n",float_list[i]);
+         result = false;
+      }
+   }
+
+   return  result;
+}
+
+bool test_parse4()
+{
+   {
+      std::string data = "0,1,2,3|+0,+1,+2,+3|-0,-1,-2,-3";
+      strtk::vector_sink<int>::type vec_sink(",");
+      strtk::deque_sink<int>::type deq_sink(",");
+      strtk::list_sink<int>::type lst_sink(",");
+
+      std::vector<int> int_vec;
+      std::deque<int> int_deq;
+      std::list<int> int_lst;
+
+      strtk::parse(data,"|",vec_sink(int_vec),
+                            deq_sink(int_deq),
+                            lst_sink(int_lst));
+
+      if (4 != int_vec.size())
+      {
+         std::cout << "test_parse4() - failed int_vec.size()" << std::endl;
+         return false;
+      }
+
+      if (4 != int_deq.size())
+      {
+         std::cout << "test_parse4() - failed int_deq.size()" << std::endl;
+         return false;
+      }
+
+      if (4 != int_lst.size())
+      {
+         std::cout << "test_parse4() - failed int_lst.size()" << std::endl;
+         return false;
+      }
+
+      std::list<int>::iterator int_lst_itr = int_lst.begin();
+
+      for (int i = 0; i <= 3; ++i)
+      {
+         if (int_vec[i] != i)
+         {
+            std::cout << "test_parse4() - failed int_vec[" << i <<"] == " << i << std::endl;
+            return false;
+         }
+
+         if (int_deq[i] != i)
+         {
+            std::cout << "test_parse4() - failed int_deq[" << i <<"] == " << i << std::endl;
+            return false;
+         }
+
+         if (*(int_lst_itr) != -i)
+         {
+            std::cout << "test_parse4() - failed int_lst[" << i <<"] == " << i << std::endl;
+            return false;
+         }
+         else
+            ++int_lst_itr;
+      }
+   }
+
+   {
+      std::string data = "0.0,1.1,2.2,3.3|+0.0,+1.1,+2.2,+3.3|-0.0,-1.1,-2.2,-3.3";
+      strtk::vector_sink<double>::type vec_sink(",");
+      strtk::deque_sink<double>::type  deq_sink(",");
+      strtk::list_sink<double>::type  lst_sink(",");
+
+      std::vector<double> double_vec;
+      std::deque<double> double_deq;
+      std::list<double> double_lst;
+
+      strtk::parse(data,"|",vec_sink(double_vec),
+                            deq_sink(double_deq),
+                            lst_sink(double_lst));
+
+      if (4 != double_vec.size())
+      {
+         std::cout << "test_parse4() - failed int_vec.size()" << std::endl;
+         return false;
+      }
+
+      if (4 != double_deq.size())
+      {
+         std::cout << "test_parse4() - failed int_deq.size()" << std::endl;
+         return false;
+      }
+
+      if (4 != double_lst.size())
+      {
+         std::cout << "test_parse4() - failed int_lst.size()" << std::endl;
+         return false;
+      }
+
+      std::list<double>::iterator double_lst_itr = double_lst.begin();
+
+      for (int i = 0; i <= 3; ++i)
+      {
+         const double expected_value = i + (i / 10.0);
+
+         if (not_equal(double_vec[i],expected_value))
+         {
+            std::cout << "test_parse4() - failed double_vec[" << i <<"] == " << i << std::endl;
+            return false;
+         }
+
+         if (not_equal(double_deq[i],expected_value))
+         {
+            std::cout << "test_parse4() - failed double_deq[" << i <<"] == " << i << std::endl;
+            return false;
+         }
+
+         if (not_equal(*(double_lst_itr),-expected_value))
+         {
+            std::cout << "test_parse4() - failed double_lst[" << i <<"] == " << i << std::endl;
+            return false;
+         }
+         else
+            ++double_lst_itr;
+      }
+   }
+
+   return true;
+}
+
+namespace test_details
+{
+   struct data_store
+   {
+      static const std::size_t member_count = 11;
+
+      data_store()
+      :   c(0),
+         uc(0),
+          s(0),
+         us(0),
+          i(0),
+         ui(0),
+         ll(0),
+        ull(0),
+        d(0.0),
+        f(0.0),
+       str("")
+      {}
+
+      char                 c;
+      unsigned char       uc;
+      short                s;
+      unsigned short      us;
+      int                  i;
+      unsigned int        ui;
+      long long           ll;
+      unsigned long long ull;
+      double               d;
+      float                f;
+      std::string        str;
+
+   };
+}
+
+bool test_kv_parse()
+{
+   {
+      static const std::size_t rounds = 20000000;
+
+      std::string slist[] =
+      {
+         "A",
+         "z",
+         "-123",
+         "456",
+         "-12345678",
+         "789012345",
+         "-43654364634645235",
+         "777777777777777777",
+         "1234.56789",
+         "0.0003f",
+         "abcdefghijklmnopqrstuvwxyz",
+      };
+
+      test_details::data_store ds;
+      strtk::util::value v1;
+      strtk::util::value v2;
+
+      for (std::size_t i = 0; i < rounds; ++i)
+      {
+         v1.assign(ds.  c); if (!v1(slist[ 0])) { std::cout << "Failed parsing slist[00] via v1!" << std::endl; return false; }
+         v1.assign(ds. uc); if (!v1(slist[ 1])) { std::cout << "Failed parsing slist[01] via v1!" << std::endl; return false; }
+         v1.assign(ds.  s); if (!v1(slist[ 2])) { std::cout << "Failed parsing slist[02] via v1!" << std::endl; return false; }
+         v1.assign(ds. us); if (!v1(slist[ 3])) { std::cout << "Failed parsing slist[03] via v1!" << std::endl; return false; }
+         v1.assign(ds.  i); if (!v1(slist[ 4])) { std::cout << "Failed parsing slist[04] via v1!" << std::endl; return false; }
+         v1.assign(ds. ui); if (!v1(slist[ 5])) { std::cout << "Failed parsing slist[05] via v1!" << std::endl; return false; }
+         v1.assign(ds. ll); if (!v1(slist[ 6])) { std::cout << "Failed parsing slist[06] via v1!" << std::endl; return false; }
+         v1.assign(ds.ull); if (!v1(slist[ 7])) { std::cout << "Failed parsing slist[07] via v1!" << std::endl; return false; }
+         v1.assign(ds.  d); if (!v1(slist[ 8])) { std::cout << "Failed parsing slist[08] via v1!" << std::endl; return false; }
+         v1.assign(ds.  f); if (!v1(slist[ 9])) { std::cout << "Failed parsing slist[09] via v1!" << std::endl; return false; }
+         v1.assign(ds.str); if (!v1(slist[10])) { std::cout << "Failed parsing slist[10] via v1!" << std::endl; return false; }
+
+         if ('A'                          != ds.  c) { std::cout << "Failed check v1 for ds.  c!" << std::endl; return false; }
+         if ('z'                          != ds. uc) { std::cout << "Failed check v1 for ds. uc!" << std::endl; return false; }
+         if (-123                         != ds.  s) { std::cout << "Failed check v1 for ds.  s!" << std::endl; return false; }
+         if (456                          != ds. us) { std::cout << "Failed check v1 for ds. us!" << std::endl; return false; }
+         if (-12345678                    != ds.  i) { std::cout << "Failed check v1 for ds.  i!" << std::endl; return false; }
+         if (789012345                    != ds. ui) { std::cout << "Failed check v1 for ds. ui!" << std::endl; return false; }
+         if (-43654364634645235LL         != ds. ll) { std::cout << "Failed check v1 for ds. ll!" << std::endl; return false; }
+         if (777777777777777777LL         != ds.ull) { std::cout << "Failed check v1 for ds.ull!" << std::endl; return false; }
+         if (1234.56789                   != ds.  d) { std::cout << "Failed check v1 for ds.  d!" << std::endl; return false; }
+         if (0.0003f                      != ds.  f) { std::cout << "Failed check v1 for ds.  f!" << std::endl; return false; }
+         if ("abcdefghijklmnopqrstuvwxyz" != ds.str) { std::cout << "Failed check v1 for ds.str!" << std::endl; return false; }
+
+         v2 = v1;
+
+         v2.assign(ds.  c); if (!v2(slist[ 0])) { std::cout << "Failed parsing slist[00] via v2!" << std::endl; return false; }
+         v2.assign(ds. uc); if (!v2(slist[ 1])) { std::cout << "Failed parsing slist[01] via v2!" << std::endl; return false; }
+         v2.assign(ds.  s); if (!v2(slist[ 2])) { std::cout << "Failed parsing slist[02] via v2!" << std::endl; return false; }
+         v2.assign(ds. us); if (!v2(slist[ 3])) { std::cout << "Failed parsing slist[03] via v2!" << std::endl; return false; }
+         v2.assign(ds.  i); if (!v2(slist[ 4])) { std::cout << "Failed parsing slist[04] via v2!" << std::endl; return false; }
+         v2.assign(ds. ui); if (!v2(slist[ 5])) { std::cout << "Failed parsing slist[05] via v2!" << std::endl; return false; }
+         v2.assign(ds. ll); if (!v2(slist[ 6])) { std::cout << "Failed parsing slist[06] via v2!" << std::endl; return false; }
+         v2.assign(ds.ull); if (!v2(slist[ 7])) { std::cout << "Failed parsing slist[07] via v2!" << std::endl; return false; }
+         v2.assign(ds.  d); if (!v2(slist[ 8])) { std::cout << "Failed parsing slist[08] via v2!" << std::endl; return false; }
+         v2.assign(ds.  f); if (!v2(slist[ 9])) { std::cout << "Failed parsing slist[09] via v2!" << std::endl; return false; }
+         v2.assign(ds.str); if (!v2(slist[10])) { std::cout << "Failed parsing slist[10] via v2!" << std::endl; return false; }
+
+         if ('A'                          != ds.  c) { std::cout << "Failed check v2 for ds.  c!" << std::endl; return false; }
+         if ('z'                          != ds. uc) { std::cout << "Failed check v2 for ds. uc!" << std::endl; return false; }
+         if (-123                         != ds.  s) { std::cout << "Failed check v2 for ds.  s!" << std::endl; return false; }
+         if (456                          != ds. us) { std::cout << "Failed check v2 for ds. us!" << std::endl; return false; }
+         if (-12345678                    != ds.  i) { std::cout << "Failed check v2 for ds.  i!" << std::endl; return false; }
+         if (789012345                    != ds. ui) { std::cout << "Failed check v2 for ds. ui!" << std::endl; return false; }
+         if (-43654364634645235LL         != ds. ll) { std::cout << "Failed check v2 for ds. ll!" << std::endl; return false; }
+         if (777777777777777777LL         != ds.ull) { std::cout << "Failed check v2 for ds.ull!" << std::endl; return false; }
+         if (1234.56789                   != ds.  d) { std::cout << "Failed check v2 for ds.  d!" << std::endl; return false; }
+         if (0.0003f                      != ds.  f) { std::cout << "Failed check v2 for ds.  f!" << std::endl; return false; }
+         if ("abcdefghijklmnopqrstuvwxyz" != ds.str) { std::cout << "Failed check v2 for ds.str!" << std::endl; return false; }
+
+      }
+   }
+
+   {
+      std::string s;
+      s.reserve(strtk::one_kilobyte);
+      std::pair<const char*, const char*> p;
+
+      for (int i = -10000000; i < +10000000; ++i)
+      {
+         strtk::type_to_string(i,s);
+         p = strtk::make_pair<const char*>(s);
+         int x = 0;
+         strtk::util::value v(x);
+
+         if (!v(p))
+         {
+            std::cout << "test_kv_parse() - (int) failed parse at index: " << i << std::endl;
+            return false;
+         }
 
-      static const std::size_t d_size = sizeof(double_str) / sizeof(std::string);
+         if (x != i)
+         {
+            std::cout << "test_kv_parse() - (int) failed value test at index: " << i << " x:" << x << std::endl;
+            return false;
+         }
+      }
+   }
 
-      double v = 0.0;
-      for (std::size_t i = 0; i < d_size; ++i)
+   {
+      std::string s;
+      s.reserve(strtk::one_kilobyte);
+      std::pair<const char*, const char*> p;
+
+      for (unsigned int i = 0; i < 20000000; ++i)
       {
-         v = 0.0;
+         strtk::type_to_string(i,s);
+         p = strtk::make_pair<const char*>(s);
+         unsigned int x = 0;
+         strtk::util::value v(x);
 
-         if (!strtk::string_to_type_converter(double_str[i],v))
+         if (!v(p))
          {
-            std::cout << "test_double_convert() double convert[" << i << "]"
-                      << " dblstr: [" << double_str[i] << "]" << std::endl;
+            std::cout << "test_kv_parse() - (unsigned int) failed parse at index: " << i << std::endl;
             return false;
          }
 
-         if (not_equal(d[i],v) && (!strtk_isnan(v)))
+         if (x != i)
          {
-            std::cout << "test_double_convert() double check[" << i << "]"
-                      << " dblstr: [" << double_str[i] << "]" << std::endl;
+            std::cout << "test_kv_parse() - (unsigned int) failed value test at index: " << i << " x:" << x << std::endl;
+            return false;
+         }
+      }
+   }
+
+   {
+      std::string s;
+      s.reserve(strtk::one_kilobyte);
+      std::pair<const char*, const char*> p;
+
+      for (int i = -10000000; i < +10000000; ++i)
+      {
+         float f = i * 0.7f;
+         strtk::type_to_string(f,s);
+         p = strtk::make_pair<const char*>(s);
+         float x = 0;
+         strtk::util::value v(x);
+
+         if (!v(p))
+         {
+            std::cout << "test_kv_parse() - (float) failed parse at index: " << i << std::endl;
+            return false;
+         }
+
+         if (not_equal(x,f,0.0000001f))
+         {
+            std::cout << "test_kv_parse() - (float) failed value test at index: " << i << " x:" << x << std::endl;
+            return false;
+         }
+      }
+   }
+
+   {
+      std::string s;
+      s.reserve(strtk::one_kilobyte);
+      std::pair<const char*, const char*> p;
+
+      for (int i = -10000000; i < +10000000; ++i)
+      {
+         double d = i * 0.7;
+         strtk::type_to_string(d,s);
+         p = strtk::make_pair<const char*>(s);
+         double x = 0;
+         strtk::util::value v(x);
+
+         if (!v(p))
+         {
+            std::cout << "test_kv_parse() - (double) failed parse at index: " << i << std::endl;
+            return false;
+         }
+
+         if (not_equal(x,d,0.0000001))
+         {
+            std::cout << "test_kv_parse() - (double) failed value test at index: " << i << " x:" << x << std::endl;
             return false;
          }
       }
+   }
+
+   return true;
+
+}
+
+bool test_replace_pattern()
+{
+   typedef std::pair<std::string,std::string> sp_type;
+   static const sp_type test[] = {
+                                   sp_type(   "a" ,   "x"),
+                                   sp_type(  "ab" ,  "xy"),
+                                   sp_type( "abc" , "xyz"),
+                                   sp_type(   "a" ,  "xy"),
+                                   sp_type(   "b" ,  "xy"),
+                                   sp_type(   "c" ,  "xy"),
+                                   sp_type(  "ab" ,   "x"),
+                                   sp_type(  "bc" ,   "x"),
+                                   sp_type(  "ca" ,   "x"),
+                                   sp_type(  "ab" , "xyz"),
+                                   sp_type(  "bc" , "xyz"),
+                                   sp_type(  "ca" , "xyz"),
+                                   sp_type( "abc" ,   "x"),
+                                   sp_type( "bca" ,   "x"),
+                                   sp_type( "cab" ,   "x"),
+                                   sp_type("abca" ,   "x"),
+                                   sp_type("bcab" ,   "x"),
+                                   sp_type("cabc" ,   "x"),
+                                   sp_type( "abc" ,    ""),
+                                   sp_type( "ijk" , "mno")
+                                 };
 
-      static const std::string bad_list[] =
-                          {
-                             "1234567.8A",      "1234567.A",      "12345A67.8",      "A1234567.8A",
-                            "1234567.8Ae", "1234567.AE+100", "12345A67.8e+100", "A1234567.8AE+100",
-                            "--1.234e+10",    "++1.234e+10",      "1.234e+10-",       "1.234e+10+",
-                             "1.234e++10",     "1.234E--10",         "1.e++10",          "1.E--10",
-                             "1..234e+10",     "1.23.4E-10",      "1.234e-1.0",            "1.23x",
-                             "1.23e+100y",               "",            "123+",             "123-",
-                                  "123.+",          "123.-",           "123+.",            "123-.",
-                               "123..123",       "123.-123",        "123.+123",           "123-.0",
-                                                             "+", "-", "+.", "-.", ".+", ".-", ".",
-                                                      "++", "--", "++.", "--.", ".++", ".--", "..",
-                                                      "+f", "-f", "+.f", "-.f", ".+f", ".-f", ".f",
-                                                      "+l", "-l", "+.l", "-.l", ".+l", ".-l", ".l",
-                              ".+0", ".+1", ".+2", ".+3", ".+4", ".+5", ".+6", ".+7", ".+8", ".+9",
-                              ".-0", ".-1", ".-2", ".-3", ".-4", ".-5", ".-6", ".-7", ".-8", ".-9",
-                    "..+0", "..+1", "..+2", "..+3", "..+4", "..+5", "..+6", "..+7", "..+8", "..+9",
-                    "..-0", "..-1", "..-2", "..-3", "..-4", "..-5", "..-6", "..-7", "..-8", "..-9",
-                    ".+0f", ".+1F", ".+2f", ".+3F", ".+4f", ".+5F", ".+6f", ".+7F", ".+8f", ".+9F",
-                    ".-0l", ".-1L", ".-2l", ".-3L", ".-4l", ".-5L", ".-6l", ".-7L", ".-8l", ".-9L"
-                          };
+   static const std::size_t test_size = sizeof(test) / sizeof(sp_type);
 
-      static const std::size_t bad_list_size = sizeof(bad_list) / sizeof(std::string);
 
-      for (std::size_t i = 0; i < bad_list_size; ++i)
+   static const std::string base[] = {
+                                       "",
+                                       "abcabcabcabcabc",
+                                       "yyabcabcabcabcabc",
+                                       "yyabcabcabcabcabckkk",
+                                       "yyabcabcabcabcabckkk",
+                                       "yabctabcabctabcabtckk",
+                                       "xyzxyzxyzxyzxyzxyzxyzxyz"
+                                       "abc"
+                                     };
+
+   static const std::size_t base_size = sizeof(base) / sizeof(std::string);
+
+   std::string result;
+   for (std::size_t i = 0; i < test_size; ++i)
+   {
+      for (std::size_t j = 0; j < base_size; ++j)
       {
-         if (strtk::string_to_type_converter(bad_list[i],v))
+         strtk::replace_pattern(base[j],test[i].first,test[i].second,result);
+         if (test[i].first != test[i].second)
          {
-            std::cout << "test_double_convert() bad test failure [" << i << "]  - [" << bad_list[i] << "]" << std::endl;
-            return false;
+            if (std::string::npos != result.find(test[i].first))
+            {
+               std::cout << "replace_pattern: s[" << base[j] << "] p[" << test[i].first << "] r[" << test[i].second << "]" << std::endl;
+               return false;
+            }
          }
       }
    }
 
+   return true;
+}
+
+bool token_grid_row_equal(const strtk::token_grid::row_type& row0, const strtk::token_grid::row_type& row1)
+{
+   if (row0.size() != row1.size())
+      return false;
+
+   for (std::size_t c = 0; c < row0.size(); ++c)
    {
-      static const std::size_t count = 10000000;
-      std::string s;
-      s.reserve(32);
-      double t = 0.0;
+      const strtk::token_grid::range_t token0 = row0.token(c);
+      const strtk::token_grid::range_t token1 = row1.token(c);
 
-      for (int i = -static_cast<int>(count); i < static_cast<int>(count); ++i)
-      {
-         if (!strtk::type_to_string(i,s))
-         {
-            std::cout << "test_double_convert() - Failed int to string @ " << i << std::endl;
-            return false;
-         }
+      if (std::distance(token0.first, token0.second) != std::distance(token1.first, token1.second))
+         return false;
+      else if (!std::equal(token0.first, token0.second, token1.first))
+         return false;
+   }
 
-         if (!strtk::string_to_type_converter(s,t))
-         {
-            std::cout << "test_double_convert() - Failed string to double @ " << i << std::endl;
-            return false;
-         }
+   return true;
+}
 
-         if (static_cast<double>(i) != t)
-         {
-            std::cout << "test_double_convert() - Failed i == t @ " << i << std::endl;
-            return false;
-         }
+bool token_grid_equal(const strtk::token_grid& g0, const strtk::token_grid& g1)
+{
+   if (g0.row_count() != g1.row_count())
+      return false;
+   else if (g0.min_column_count() != g1.min_column_count())
+      return false;
+   else if (g0.max_column_count() != g1.max_column_count())
+      return false;
 
-         s.clear();
-      }
+   for (std::size_t r = 0; r < g0.row_count(); ++r)
+   {
+      if (!token_grid_row_equal(g0.row(r),g1.row(r)))
+         return false;
    }
 
+   return true;
+}
+
+std::string random_dsv_string(const std::size_t length, const bool with_quotes)
+{
+   static const char alphabet[] = "abcd,,||\n\n\r  \"";
+   const std::size_t alphabet_size = sizeof(alphabet) - (with_quotes ? 1 : 2);
+
+   std::string s(length,' ');
+
+   for (std::size_t i = 0; i < length; ++i)
    {
-      std::string s;
-      s.reserve(256);
+      s[i] = alphabet[std::rand() % alphabet_size];
+   }
 
-      double v = -111111.11;
-      double t = 0.0;
+   return s;
+}
 
-      while (v < +111111.11)
-      {
-         std_double_to_string(v,s);
+bool test_token_grid_structural_index()
+{
+   static const strtk::split_options::type split_option_list[] =
+                  {
+                     strtk::split_options::default_mode,
+                     strtk::split_options::compress_delimiters,
+                     strtk::split_options::include_1st_delimiter,
+                     strtk::split_options::include_1st_delimiter  | strtk::split_options::compress_delimiters,
+                     strtk::split_options::include_all_delimiters
+                  };
 
-         if (!strtk::string_to_type_converter(s,t))
-         {
-            std::cout << "test_double_convert() - Failed decimal to string,  t: " << t << std::endl;
-            return false;
-         }
+   static const std::size_t split_option_list_size = sizeof(split_option_list) / sizeof(strtk::split_options::type);
 
-         if (not_equal(t,v,0.0000000001))
+   std::srand(static_cast<unsigned int>(strtk::magic_seed));
+
+   for (std::size_t length = 1; length < 400; length += 3)
+   {
+      for (std::size_t i = 0; i < split_option_list_size; ++i)
+      {
+         for (std::size_t q = 0; q < 3; ++q)
          {
-            std::cout << "test_double_convert() - Failed decimal r == t  r: " << t << std::endl;
-            return false;
-         }
+            const bool with_quotes = (q > 0);
 
-         v += 0.01;
-         s.clear();
-         t = 0.0;
+            const std::string s = random_dsv_string(length, with_quotes);
+
+            strtk::token_grid::options options;
+            options.set_column_delimiters(",| ")
+                   .set_column_split_option(split_option_list[i]);
+            options.support_dquotes = with_quotes;
+            options.trim_dquotes    = (2 == q);
+
+            strtk::token_grid grid0(s, s.size(), options);
+            strtk::token_grid grid1(s, s.size(), options.set_structural_index(true));
+
+            if (!token_grid_equal(grid0,grid1))
+            {
+               std::cout << "test_token_grid_structural_index() - Failed  option: " << split_option_list[i]
+                         << " quotes: " << q << " input: [" << s << "]" << std::endl;
+               return false;
+            }
+         }
       }
    }
 
    {
-      double d1 = +123.456;
-      double d2 = -123.456;
-      double delta[] =
-             {
-               0.333,   0.555,   0.777,
-               0.999, 0.13579, 0.97531
-             };
-      std::size_t delta_size = sizeof(delta) / sizeof(double);
-
       std::string s;
-      s.reserve(256);
-      double tmp = 0.0;
 
-      for (int i = 0; i < 1000000; ++i)
+      for (std::size_t i = 0; i < 20000; ++i)
       {
-         std_double_to_string(d1,s);
+         s += "abc,\"d|e\",123|45.67,,xyz\n";
+      }
 
-         if (!strtk::string_to_type_converter(s,tmp))
-         {
-            std::cout << "test_double_convert() - (1) final test string to double failure @ " << i << std::endl;
-            return false;
-         }
+      strtk::token_grid::options options;
+      options.set_column_delimiters(",|")
+             .set_column_split_option(strtk::split_options::default_mode);
+      options.support_dquotes = true;
 
-         if (not_equal(d1,tmp,0.000000001))
-         {
-            std::cout << "test_double_convert() - (1) final test compare failure @ " << i << std::endl;
-            return false;
-         }
+      strtk::token_grid grid0(s, s.size(), options);
+      strtk::token_grid grid1(s, s.size(), options.set_structural_index(true));
 
-         d1 += delta[std::abs(i) % delta_size];
+      if (!token_grid_equal(grid0,grid1) || (20000 != grid1.row_count()) || (6 != grid1.max_column_count()))
+      {
+         std::cout << "test_token_grid_structural_index() - Failed multi-chunk test" << std::endl;
+         return false;
+      }
+   }
 
-         std_double_to_string(d2,s);
+   return true;
+}
 
-         if (!strtk::string_to_type_converter(s,tmp))
-         {
-            std::cout << "test_double_convert() - (2) final test string to double failure @ " << i << std::endl;
-            return false;
-         }
+bool test_token_grid_dquotes()
+{
+   static const std::string data = "a,\"b,c\",d\n"
+                                   "\"x \"\"y\"\" z\",,\"\"\n"
+                                   "\"p\nq\",r\n"
+                                   "1,\"2\"\"\",3\n";
 
-         if (not_equal(d2,tmp,0.000000001))
-         {
-            std::cout << "test_double_convert() - (2) final test compare failure @ " << i << std::endl;
-            return false;
-         }
+   static const std::string expected[] =
+                  {
+                     "a|b,c|d",
+                     "x \"\"y\"\" z||",
+                     "\"p",
+                     "q\"|r",
+                     "1|2\"\"|3"
+                  };
 
-         d2 -= delta[std::abs(i) % delta_size];
-      }
-   }
+   static const std::size_t expected_size = sizeof(expected) / sizeof(std::string);
+
+   strtk::token_grid::options options;
+   options.set_column_delimiters(",")
+          .set_column_split_option(strtk::split_options::default_mode);
+   options.support_dquotes = true;
+   options.trim_dquotes    = true;
+
+   bool result = true;
 
+   for (std::size_t pass = 0; pass < 2; ++pass)
    {
-      static const std::string dbl_str_list[] =
-                                  {
-                                     "0.0",
-                                     "1.0E+001", "1.0E+002", "1.0E+003", "1.0E+004", "1.0E+005", "1.0E+006", "1.0E+007", "1.0E+008", "1.0E+009", "1.0E+010",
-                                     "1.0E+011", "1.0E+012", "1.0E+013", "1.0E+014", "1.0E+015", "1.0E+016", "1.0E+017", "1.0E+018", "1.0E+019", "1.0E+020",
-                                     "1.0E+021", "1.0E+022", "1.0E+023", "1.0E+024", "1.0E+025", "1.0E+026", "1.0E+027", "1.0E+028", "1.0E+029", "1.0E+030",
-                                     "1.0E+031", "1.0E+032", "1.0E+033", "1.0E+034", "1.0E+035", "1.0E+036", "1.0E+037", "1.0E+038", "1.0E+039", "1.0E+040",
-                                     "1.0E+041", "1.0E+042", "1.0E+043", "1.0E+044", "1.0E+045", "1.0E+046", "1.0E+047", "1.0E+048", "1.0E+049", "1.0E+050",
-                                     "1.0E+051", "1.0E+052", "1.0E+053", "1.0E+054", "1.0E+055", "1.0E+056", "1.0E+057", "1.0E+058", "1.0E+059", "1.0E+060",
-                                     "1.0E+061", "1.0E+062", "1.0E+063", "1.0E+064", "1.0E+065", "1.0E+066", "1.0E+067", "1.0E+068", "1.0E+069", "1.0E+070",
-                                     "1.0E+071", "1.0E+072", "1.0E+073", "1.0E+074", "1.0E+075", "1.0E+076", "1.0E+077", "1.0E+078", "1.0E+079", "1.0E+080",
-                                     "1.0E+081", "1.0E+082", "1.0E+083", "1.0E+084", "1.0E+085", "1.0E+086", "1.0E+087", "1.0E+088", "1.0E+089", "1.0E+090",
-                                     "1.0E+091", "1.0E+092", "1.0E+093", "1.0E+094", "1.0E+095", "1.0E+096", "1.0E+097", "1.0E+098", "1.0E+099", "1.0E+100",
-                                     "1.0E+101", "1.0E+102", "1.0E+103", "1.0E+104", "1.0E+105", "1.0E+106", "1.0E+107", "1.0E+108", "1.0E+109", "1.0E+110",
-                                     "1.0E+111", "1.0E+112", "1.0E+113", "1.0E+114", "1.0E+115", "1.0E+116", "1.0E+117", "1.0E+118", "1.0E+119", "1.0E+120",
-                                     "1.0E+121", "1.0E+122", "1.0E+123", "1.0E+124", "1.0E+125", "1.0E+126", "1.0E+127", "1.0E+128", "1.0E+129", "1.0E+130",
-                                     "1.0E+131", "1.0E+132", "1.0E+133", "1.0E+134", "1.0E+135", "1.0E+136", "1.0E+137", "1.0E+138", "1.0E+139", "1.0E+140",
-                                     "1.0E+141", "1.0E+142", "1.0E+143", "1.0E+144", "1.0E+145", "1.0E+146", "1.0E+147", "1.0E+148", "1.0E+149", "1.0E+150",
-                                     "1.0E+151", "1.0E+152", "1.0E+153", "1.0E+154", "1.0E+155", "1.0E+156", "1.0E+157", "1.0E+158", "1.0E+159", "1.0E+160",
-                                     "1.0E+161", "1.0E+162", "1.0E+163", "1.0E+164", "1.0E+165", "1.0E+166", "1.0E+167", "1.0E+168", "1.0E+169", "1.0E+170",
-                                     "1.0E+171", "1.0E+172", "1.0E+173", "1.0E+174", "1.0E+175", "1.0E+176", "1.0E+177", "1.0E+178", "1.0E+179", "1.0E+180",
-                                     "1.0E+181", "1.0E+182", "1.0E+183", "1.0E+184", "1.0E+185", "1.0E+186", "1.0E+187", "1.0E+188", "1.0E+189", "1.0E+190",
-                                     "1.0E+191", "1.0E+192", "1.0E+193", "1.0E+194", "1.0E+195", "1.0E+196", "1.0E+197", "1.0E+198", "1.0E+199", "1.0E+200",
-                                     "1.0E+201", "1.0E+202", "1.0E+203", "1.0E+204", "1.0E+205", "1.0E+206", "1.0E+207", "1.0E+208", "1.0E+209", "1.0E+210",
-                                     "1.0E+211", "1.0E+212", "1.0E+213", "1.0E+214", "1.0E+215", "1.0E+216", "1.0E+217", "1.0E+218", "1.0E+219", "1.0E+220",
-                                     "1.0E+221", "1.0E+222", "1.0E+223", "1.0E+224", "1.0E+225", "1.0E+226", "1.0E+227", "1.0E+228", "1.0E+229", "1.0E+230",
-                                     "1.0E+231", "1.0E+232", "1.0E+233", "1.0E+234", "1.0E+235", "1.0E+236", "1.0E+237", "1.0E+238", "1.0E+239", "1.0E+240",
-                                     "1.0E+241", "1.0E+242", "1.0E+243", "1.0E+244", "1.0E+245", "1.0E+246", "1.0E+247", "1.0E+248", "1.0E+249", "1.0E+250",
-                                     "1.0E+251", "1.0E+252", "1.0E+253", "1.0E+254", "1.0E+255", "1.0E+256", "1.0E+257", "1.0E+258", "1.0E+259", "1.0E+260",
-                                     "1.0E+261", "1.0E+262", "1.0E+263", "1.0E+264", "1.0E+265", "1.0E+266", "1.0E+267", "1.0E+268", "1.0E+269", "1.0E+270",
-                                     "1.0E+271", "1.0E+272", "1.0E+273", "1.0E+274", "1.0E+275", "1.0E+276", "1.0E+277", "1.0E+278", "1.0E+279", "1.0E+280",
-                                     "1.0E+281", "1.0E+282", "1.0E+283", "1.0E+284", "1.0E+285", "1.0E+286", "1.0E+287", "1.0E+288", "1.0E+289", "1.0E+290",
-                                     "1.0E+291", "1.0E+292", "1.0E+293", "1.0E+294", "1.0E+295", "1.0E+296", "1.0E+297", "1.0E+298", "1.0E+299", "1.0E+300",
-                                     "1.0E+301", "1.0E+302", "1.0E+303", "1.0E+304", "1.0E+305", "1.0E+306", "1.0E+307", "1.0E+308"
-                                  };
-      static const std::size_t dbl_str_list_size = sizeof(dbl_str_list) / sizeof(std::string);
+      strtk::token_grid grid(data, data.size(), options.set_worker_count(1 + 3 * pass));
 
-      static const double dbl_list[] =
-                                  {
-                                     0.0,
-                                     1.0E+001, 1.0E+002, 1.0E+003, 1.0E+004, 1.0E+005, 1.0E+006, 1.0E+007, 1.0E+008, 1.0E+009, 1.0E+010,
-                                     1.0E+011, 1.0E+012, 1.0E+013, 1.0E+014, 1.0E+015, 1.0E+016, 1.0E+017, 1.0E+018, 1.0E+019, 1.0E+020,
-                                     1.0E+021, 1.0E+022, 1.0E+023, 1.0E+024, 1.0E+025, 1.0E+026, 1.0E+027, 1.0E+028, 1.0E+029, 1.0E+030,
-                                     1.0E+031, 1.0E+032, 1.0E+033, 1.0E+034, 1.0E+035, 1.0E+036, 1.0E+037, 1.0E+038, 1.0E+039, 1.0E+040,
-                                     1.0E+041, 1.0E+042, 1.0E+043, 1.0E+044, 1.0E+045, 1.0E+046, 1.0E+047, 1.0E+048, 1.0E+049, 1.0E+050,
-                                     1.0E+051, 1.0E+052, 1.0E+053, 1.0E+054, 1.0E+055, 1.0E+056, 1.0E+057, 1.0E+058, 1.0E+059, 1.0E+060,
-                                     1.0E+061, 1.0E+062, 1.0E+063, 1.0E+064, 1.0E+065, 1.0E+066, 1.0E+067, 1.0E+068, 1.0E+069, 1.0E+070,
-                                     1.0E+071, 1.0E+072, 1.0E+073, 1.0E+074, 1.0E+075, 1.0E+076, 1.0E+077, 1.0E+078, 1.0E+079, 1.0E+080,
-                                     1.0E+081, 1.0E+082, 1.0E+083, 1.0E+084, 1.0E+085, 1.0E+086, 1.0E+087, 1.0E+088, 1.0E+089, 1.0E+090,
-                                     1.0E+091, 1.0E+092, 1.0E+093, 1.0E+094, 1.0E+095, 1.0E+096, 1.0E+097, 1.0E+098, 1.0E+099, 1.0E+100,
-                                     1.0E+101, 1.0E+102, 1.0E+103, 1.0E+104, 1.0E+105, 1.0E+106, 1.0E+107, 1.0E+108, 1.0E+109, 1.0E+110,
-                                     1.0E+111, 1.0E+112, 1.0E+113, 1.0E+114, 1.0E+115, 1.0E+116, 1.0E+117, 1.0E+118, 1.0E+119, 1.0E+120,
-                                     1.0E+121, 1.0E+122, 1.0E+123, 1.0E+124, 1.0E+125, 1.0E+126, 1.0E+127, 1.0E+128, 1.0E+129, 1.0E+130,
-                                     1.0E+131, 1.0E+132, 1.0E+133, 1.0E+134, 1.0E+135, 1.0E+136, 1.0E+137, 1.0E+138, 1.0E+139, 1.0E+140,
-                                     1.0E+141, 1.0E+142, 1.0E+143, 1.0E+144, 1.0E+145, 1.0E+146, 1.0E+147, 1.0E+148, 1.0E+149, 1.0E+150,
-                                     1.0E+151, 1.0E+152, 1.0E+153, 1.0E+154, 1.0E+155, 1.0E+156, 1.0E+157, 1.0E+158, 1.0E+159, 1.0E+160,
-                                     1.0E+161, 1.0E+162, 1.0E+163, 1.0E+164, 1.0E+165, 1.0E+166, 1.0E+167, 1.0E+168, 1.0E+169, 1.0E+170,
-                                     1.0E+171, 1.0E+172, 1.0E+173, 1.0E+174, 1.0E+175, 1.0E+176, 1.0E+177, 1.0E+178, 1.0E+179, 1.0E+180,
-                                     1.0E+181, 1.0E+182, 1.0E+183, 1.0E+184, 1.0E+185, 1.0E+186, 1.0E+187, 1.0E+188, 1.0E+189, 1.0E+190,
-                                     1.0E+191, 1.0E+192, 1.0E+193, 1.0E+194, 1.0E+195, 1.0E+196, 1.0E+197, 1.0E+198, 1.0E+199, 1.0E+200,
-                                     1.0E+201, 1.0E+202, 1.0E+203, 1.0E+204, 1.0E+205, 1.0E+206, 1.0E+207, 1.0E+208, 1.0E+209, 1.0E+210,
-                                     1.0E+211, 1.0E+212, 1.0E+213, 1.0E+214, 1.0E+215, 1.0E+216, 1.0E+217, 1.0E+218, 1.0E+219, 1.0E+220,
-                                     1.0E+221, 1.0E+222, 1.0E+223, 1.0E+224, 1.0E+225, 1.0E+226, 1.0E+227, 1.0E+228, 1.0E+229, 1.0E+230,
-                                     1.0E+231, 1.0E+232, 1.0E+233, 1.0E+234, 1.0E+235, 1.0E+236, 1.0E+237, 1.0E+238, 1.0E+239, 1.0E+240,
-                                     1.0E+241, 1.0E+242, 1.0E+243, 1.0E+244, 1.0E+245, 1.0E+246, 1.0E+247, 1.0E+248, 1.0E+249, 1.0E+250,
-                                     1.0E+251, 1.0E+252, 1.0E+253, 1.0E+254, 1.0E+255, 1.0E+256, 1.0E+257, 1.0E+258, 1.0E+259, 1.0E+260,
-                                     1.0E+261, 1.0E+262, 1.0E+263, 1.0E+264, 1.0E+265, 1.0E+266, 1.0E+267, 1.0E+268, 1.0E+269, 1.0E+270,
-                                     1.0E+271, 1.0E+272, 1.0E+273, 1.0E+274, 1.0E+275, 1.0E+276, 1.0E+277, 1.0E+278, 1.0E+279, 1.0E+280,
-                                     1.0E+281, 1.0E+282, 1.0E+283, 1.0E+284, 1.0E+285, 1.0E+286, 1.0E+287, 1.0E+288, 1.0E+289, 1.0E+290,
-                                     1.0E+291, 1.0E+292, 1.0E+293, 1.0E+294, 1.0E+295, 1.0E+296, 1.0E+297, 1.0E+298, 1.0E+299, 1.0E+300,
-                                     1.0E+301, 1.0E+302, 1.0E+303, 1.0E+304, 1.0E+305, 1.0E+306, 1.0E+307, 1.0E+308
-                                  };
+      if (expected_size != grid.row_count())
+      {
+         std::cout << "test_token_grid_dquotes() - Failed row count, pass: " << pass << std::endl;
+         return false;
+      }
 
-      for (std::size_t i = 0; i < dbl_str_list_size; ++i)
+      for (std::size_t i = 0; i < expected_size; ++i)
       {
-         double d = std::numeric_limits<double>::quiet_NaN();
+         std::string s;
 
-         if (!strtk::string_to_type_converter(dbl_str_list[i],d))
+         for (std::size_t j = 0; j < grid.row(i).size(); ++j)
          {
-            std::cout << "test_double_convert() - Failed frac-table string to double: " << dbl_str_list[i] << std::endl;
-            return false;
+            if (j) s += '|';
+            s += grid.row(i).get<std::string>(j);
          }
 
-         if (not_equal(dbl_list[i],d,0.0000000001))
+         if (expected[i] != s)
          {
-            std::cout << "test_double_convert() - Failed frac-table i == d: " << dbl_str_list[i] << std::endl;
-            return false;
+            std::cout << "test_token_grid_dquotes() - Failed row: " << i
+                      << " expected: [" << expected[i] << "] got: [" << s << "]" << std::endl;
+            result = false;
          }
       }
    }
 
-   return true;
+   return result;
 }
 
-bool test_construct_and_parse()
+bool test_token_grid_parallel_load()
 {
-   data_block i;
-   std::string output = "";
-   i.d1  = "The quick brown fox jumps over the lazy dog";
-   i.d2  = 'x';
-   i.d3  = -1234;
-   i.d4  = 78901;
-   i.d5  = 4567.8901;
-   i.d6  = 123.456f;
-   i.d7  = -16000;
-   i.d8  = 15000;
-   i.d9  = true;
-   i.d10 = 0xEE;
+   std::srand(static_cast<unsigned int>(strtk::magic_seed));
 
-   strtk::construct(output, "|", i.d1, i.d2, i.d3, i.d4, i.d5, i.d6, i.d7, i.d8, i.d9, i.d10);
-   data_block o = i;
+   for (std::size_t i = 0; i < 8; ++i)
+   {
+      const bool with_quotes = (1 == (i & 1));
+      const std::string s = random_dsv_string(300000 + std::rand() % 1000, with_quotes);
 
-   bool result = true;
+      strtk::token_grid::options options;
+      options.set_column_delimiters(",| ")
+             .set_column_split_option((i & 2) ? strtk::split_options::compress_delimiters : strtk::split_options::default_mode)
+             .set_structural_index(4 <= i);
+      options.support_dquotes = with_quotes;
+      options.trim_dquotes    = with_quotes;
 
-   o.clear(1);
-   result = strtk::parse(output, "|", o.d1);
+      strtk::token_grid grid0(s, s.size(), options);
+      strtk::token_grid grid1(s, s.size(), options.set_worker_count(4));
 
-   if (!result || (o != i))
-   {
-      std::cout << "test_construct_and_parse() - parse fail 1" << std::endl;
-      return false;
+      if (!token_grid_equal(grid0,grid1))
+      {
+         std::cout << "test_token_grid_parallel_load() - Failed test: " << i << std::endl;
+         return false;
+      }
    }
 
-   o.clear(2);
-   result = strtk::parse(output, "|", o.d1, o.d2);
-
-   if (!result || (o != i))
-   {
-      std::cout << "test_construct_and_parse() - parse fail 2" << std::endl;
-      return false;
-   }
+   return true;
+}
 
-   o.clear(3);
-   result = strtk::parse(output, "|", o.d1, o.d2, o.d3);
+bool test_token_grid_lazy_index()
+{
+   std::srand(static_cast<unsigned int>(strtk::magic_seed));
 
-   if (!result || (o != i))
+   for (std::size_t i = 0; i < 4; ++i)
    {
-      std::cout << "test_construct_and_parse() - parse fail 3" << std::endl;
-      return false;
-   }
+      const std::string s = random_dsv_string(200000 + std::rand() % 1000, false);
 
-   o.clear(4);
-   result = strtk::parse(output, "|", o.d1, o.d2, o.d3, o.d4);
+      strtk::token_grid::options options;
+      options.set_column_delimiters(",| ")
+             .set_column_split_option((i & 1) ? strtk::split_options::compress_delimiters : strtk::split_options::default_mode)
+             .set_structural_index(2 <= i);
 
-   if (!result || (o != i))
-   {
-      std::cout << "test_construct_and_parse() - parse fail 4" << std::endl;
-      return false;
-   }
+      strtk::token_grid grid0(s, s.size(), options);
+      strtk::token_grid grid1(s, s.size(), options.set_lazy_index(true));
 
-   o.clear(5);
-   result = strtk::parse(output, "|", o.d1, o.d2, o.d3, o.d4, o.d5);
+      for (std::size_t k = 0; k < 100; ++k)
+      {
+         const std::size_t r = std::rand() % grid0.row_count();
 
-   if (!result || (o != i))
-   {
-      std::cout << "test_construct_and_parse() - parse fail 5" << std::endl;
-      return false;
-   }
+         if (!token_grid_row_equal(grid0.row(r),grid1.row(r)))
+         {
+            std::cout << "test_token_grid_lazy_index() - Failed row test: " << i << " row: " << r << std::endl;
+            return false;
+         }
+      }
 
-   o.clear(6);
-   result = strtk::parse(output, "|", o.d1, o.d2, o.d3, o.d4, o.d5, o.d6);
+      const strtk::token_grid::row_range_t row_range(10,60);
+      std::string column0;
+      std::string column1;
 
-   if (!result || (o != i))
-   {
-      std::cout << "test_construct_and_parse() - parse fail 6" << std::endl;
-      return false;
-   }
+      grid0.join_column(0, row_range, "|", column0);
+      grid1.join_column(0, row_range, "|", column1);
 
-   o.clear(7);
-   result = strtk::parse(output, "|", o.d1, o.d2, o.d3, o.d4, o.d5, o.d6, o.d7);
+      if (column0 != column1)
+      {
+         std::cout << "test_token_grid_lazy_index() - Failed join test: " << i << std::endl;
+         return false;
+      }
 
-   if (!result || (o != i))
-   {
-      std::cout << "test_construct_and_parse() - parse fail 7" << std::endl;
-      return false;
-   }
+      if (!token_grid_equal(grid0,grid1))
+      {
+         std::cout << "test_token_grid_lazy_index() - Failed comparison test: " << i << std::endl;
+         return false;
+      }
 
-   o.clear(8);
-   result = strtk::parse(output, "|", o.d1, o.d2, o.d3, o.d4, o.d5, o.d6, o.d7, o.d8);
+      grid1.load(reinterpret_cast<unsigned char*>(const_cast<char*>(s.data())), s.size(), options);
 
-   if (!result || (o != i))
-   {
-      std::cout << "test_construct_and_parse() - parse fail 8" << std::endl;
-      return false;
-   }
+      // Rows indexed out of order are rearranged before removals.
+      for (std::size_t k = 0; k < 20; ++k)
+      {
+         grid1.row(std::rand() % grid0.row_count());
+      }
 
-   o.clear(9);
-   result = strtk::parse(output, "|", o.d1, o.d2, o.d3, o.d4, o.d5, o.d6, o.d7, o.d8, o.d9);
+      if (grid0.max_column_count() != grid1.max_column_count())
+      {
+         std::cout << "test_token_grid_lazy_index() - Failed max column test: " << i << std::endl;
+         return false;
+      }
 
-   if (!result || (o != i))
-   {
-      std::cout << "test_construct_and_parse() - parse fail 9" << std::endl;
-      return false;
-   }
+      grid0.remove_row(5);
+      grid1.remove_row(5);
 
-   o.clear(10);
-   result = strtk::parse(output, "|", o.d1, o.d2, o.d3, o.d4, o.d5, o.d6, o.d7, o.d8, o.d9, o.d10);
+      if (!token_grid_equal(grid0,grid1))
+      {
+         std::cout << "test_token_grid_lazy_index() - Failed removal test: " << i << std::endl;
+         return false;
+      }
+   }
 
-   if (!result || (o != i))
+   for (std::size_t i = 0; i < 4; ++i)
    {
-      std::cout << "test_construct_and_parse() - parse fail 10" << std::endl;
-      return false;
-   }
+      const std::string s = random_dsv_string(100000 + std::rand() % 1000, true);
 
-   return true;
-}
+      strtk::token_grid::options options;
+      options.set_column_delimiters(",| ")
+             .set_column_split_option((i & 1) ? strtk::split_options::compress_delimiters : strtk::split_options::default_mode);
+      options.support_dquotes = true;
+      options.trim_dquotes    = (2 <= i);
 
-bool test_int_uint_convert()
-{
-   static const std::size_t count = 20000000;
-   std::string s;
-   s.reserve(32);
+      strtk::token_grid grid0(s, s.size(), options);
+      strtk::token_grid grid1(s, s.size(), options.set_lazy_index(true));
 
-   {
-      const std::string test_str[] =
-      {
-         "0",
-         "1",
-         "12",
-         "123",
-         "1234",
-         "12345",
-         "123456",
-         "1234567",
-         "12345678",
-         "123456789",
-         "-0",
-         "-1",
-         "-12",
-         "-123",
-         "-1234",
-         "-12345",
-         "-123456",
-         "-1234567",
-         "-12345678",
-         "-123456789",
-         "-2147483574"
-      };
+      std::vector<std::size_t> row_list;
+      std::vector<strtk::token_grid::row_type> lazy_row_list;
 
-      const int test_int[] =
+      for (std::size_t k = 0; k < 100; ++k)
       {
-         0,
-         1,
-         12,
-         123,
-         1234,
-         12345,
-         123456,
-         1234567,
-         12345678,
-         123456789,
-         -0,
-         -1,
-         -12,
-         -123,
-         -1234,
-         -12345,
-         -123456,
-         -1234567,
-         -12345678,
-         -123456789,
-         -2147483574
-      };
+         row_list.push_back(std::rand() % grid0.row_count());
+      }
 
-      for (std::size_t i = 0; i < sizeof(test_str) / sizeof(std::string); ++i)
+      for (std::size_t k = 0; k < row_list.size(); ++k)
       {
-         int t = 9999999;
+         lazy_row_list.push_back(grid1.row(row_list[k]));
 
-         if (!strtk::string_to_type_converter(test_str[i],t))
+         if (!token_grid_row_equal(grid0.row(row_list[k]),lazy_row_list.back()))
          {
-            std::cout << "test_int_uint_convert() - Failed basic string to int @ " << i << std::endl;
+            std::cout << "test_token_grid_lazy_index() - Failed quoted row test: " << i << " row: " << row_list[k] << std::endl;
             return false;
          }
+      }
 
-         if (test_int[i] != t)
+      // Materialising the index must leave previously obtained rows valid.
+      if (
+           (grid0.min_column_count() != grid1.min_column_count()) ||
+           (grid0.max_column_count() != grid1.max_column_count())
+         )
+      {
+         std::cout << "test_token_grid_lazy_index() - Failed quoted min/max column test: " << i << std::endl;
+         return false;
+      }
+
+      for (std::size_t k = 0; k < row_list.size(); ++k)
+      {
+         if (!token_grid_row_equal(grid0.row(row_list[k]),lazy_row_list[k]))
          {
-            std::cout << "test_int_uint_convert() - Failed basic (int) i == t @ " << i << std::endl;
+            std::cout << "test_token_grid_lazy_index() - Failed quoted materialise test: " << i << " row: " << row_list[k] << std::endl;
             return false;
          }
       }
 
+      if (!token_grid_equal(grid0,grid1))
+      {
+         std::cout << "test_token_grid_lazy_index() - Failed quoted comparison test: " << i << std::endl;
+         return false;
+      }
    }
 
    {
-      int t = 0;
+      const std::string s = "\"a,b\",c\n\n\"d\",e,\"f,g\"\nh\n";
 
-      for (int i = -static_cast<int>(count); i < static_cast<int>(count); ++i)
+      strtk::token_grid::options options;
+      options.set_column_delimiters(",");
+      options.support_dquotes = true;
+      options.trim_dquotes    = true;
+
+      strtk::token_grid grid0(s, s.size(), options);
+      strtk::token_grid grid1(s, s.size(), options.set_lazy_index(true));
+
+      if (
+           !token_grid_row_equal(grid0.row(1),grid1.row(1)) ||
+           !token_grid_row_equal(grid0.row(0),grid1.row(0)) ||
+           !token_grid_equal(grid0,grid1)
+         )
       {
-         if (!strtk::type_to_string(i,s))
-         {
-            std::cout << "test_int_uint_convert() - Failed int to string @ " << i << std::endl;
-            return false;
-         }
+         std::cout << "test_token_grid_lazy_index() - Failed double quote test" << std::endl;
+         return false;
+      }
+   }
 
-         if (!strtk::string_to_type_converter(s,t))
-         {
-            std::cout << "test_int_uint_convert() - Failed string to int @ " << i << std::endl;
-            return false;
-         }
+   return true;
+}
 
-         if (i != t)
-         {
-            std::cout << "test_int_uint_convert() - Failed (int) i == t @ " << i << std::endl;
-            return false;
-         }
+bool test_token_grid_index_file()
+{
+   static const std::string file_name  = "strtk_token_grid_index_test.txt";
+   static const std::string index_name = "strtk_token_grid_index_test.idx";
 
-         s.clear();
-      }
+   std::srand(static_cast<unsigned int>(strtk::magic_seed));
+
+   std::string s = random_dsv_string(100000, true);
+
+   {
+      std::ofstream stream(file_name.c_str(),std::ios::binary);
+      stream.write(s.data(),static_cast<std::streamsize>(s.size()));
    }
 
+   std::remove(index_name.c_str());
+
+   strtk::token_grid::options options;
+   options.set_column_delimiters(",| ");
+   options.support_dquotes = true;
+
+   bool result = true;
+
    {
-      unsigned int t = 0;
+      strtk::token_grid grid0(file_name, options);
+      strtk::token_grid grid1(file_name, options.set_index_file(index_name));
+      strtk::token_grid grid2(file_name, options);
 
-      for (unsigned int i = 0; i < (2 * count); ++i)
+      if (!token_grid_equal(grid0,grid1) || !token_grid_equal(grid0,grid2) || !std::ifstream(index_name.c_str()))
       {
-         if (!strtk::type_to_string(i,s))
-         {
-            std::cout << "test_int_uint_convert() - Failed uint to string @ " << i << std::endl;
-            return false;
-         }
+         std::cout << "test_token_grid_index_file() - Failed index round trip test" << std::endl;
+         result = false;
+      }
 
-         if (!strtk::string_to_type_converter(s,t))
-         {
-            std::cout << "test_int_uint_convert() - Failed string to uint @ " << i << std::endl;
-            return false;
-         }
+      // An index saved after removing rows shows that the sidecar is adopted.
+      grid2.remove_row(0);
 
-         if (i != t)
-         {
-            std::cout << "test_int_uint_convert() - Failed (uint) i == t @ " << i << std::endl;
-            return false;
-         }
+      if (!grid2.save_index(index_name))
+      {
+         std::cout << "test_token_grid_index_file() - Failed save test" << std::endl;
+         result = false;
+      }
+
+      strtk::token_grid grid3(file_name, options);
+
+      if ((grid0.row_count() != (grid3.row_count() + 1)) || !token_grid_row_equal(grid0.row(1),grid3.row(0)))
+      {
+         std::cout << "test_token_grid_index_file() - Failed index adoption test" << std::endl;
+         result = false;
+      }
 
-         s.clear();
+      strtk::token_grid grid4(file_name, options.set_column_delimiters(","));
+      strtk::token_grid grid5(file_name, options.set_index_file(""));
+
+      if (!token_grid_equal(grid4,grid5))
+      {
+         std::cout << "test_token_grid_index_file() - Failed options mismatch test" << std::endl;
+         result = false;
       }
+
+      grid2.save_index(index_name);
    }
 
-   static const std::string bad_list[]
-                = {
-                     "12345678901",            "+12345678901",
-                     "123456789012",           "+123456789012",
-                     "1234567890123",          "+1234567890123",
-                     "12345678901234",         "+12345678901234",
-                     "123456789012345",        "+123456789012345",
-                     "00000123456789012345",   "+00000123456789012345",
-                     "12345678901234500000",   "+12345678901234500000",
-                     "1234A",                  "+1234A",
-                     "12A34",                  "+12A34",
-                     "A1234",                  "+A1234",
-                     "-12345678901",           "012345678901",
-                     "-123456789012",          "00123456789012",
-                     "-1234567890123",         "0001234567890123",
-                     "-12345678901234",        "00012345678901234",
-                     "-123456789012345",       "000123456789012345",
-                     "-00000123456789012345",  "-012345678901",
-                     "-12345678901234500000",  "-00123456789012",
-                     "-1234A",                 "-0001234567890123",
-                     "-12A34",                 "-00012345678901234",
-                     "-A1234",                 "-000123456789012345",
-                     "+012345678901",
-                     "+00123456789012",
-                     "+0001234567890123",
-                     "+00012345678901234",
-                     "+000123456789012345",
-                     "+", "-", "+-", "-+", ""
-                  };
-   static const std::size_t bad_list_size = sizeof(bad_list) / sizeof(std::string);
+   {
+      s[0] = ('a' == s[0]) ? 'b' : 'a';
+
+      std::ofstream stream(file_name.c_str(),std::ios::binary);
+      stream.write(s.data(),static_cast<std::streamsize>(s.size()));
+   }
 
    {
-      int t = 0;
+      options.set_column_delimiters(",| ");
 
-      for (std::size_t i = 0; i < bad_list_size; ++i)
-      {
-         if (strtk::string_to_type_converter(bad_list[i],t))
-         {
-            std::cout << "test_int_uint_convert() - Failed bad test for int @ " << i
-                      << " str: [" << bad_list[i] << "]" << std::endl;
+      strtk::token_grid grid0(file_name, options);
+      strtk::token_grid grid1(file_name, options.set_index_file(index_name));
 
-            return false;
-         }
+      if (!token_grid_equal(grid0,grid1))
+      {
+         std::cout << "test_token_grid_index_file() - Failed stale index test" << std::endl;
+         result = false;
       }
    }
 
+   std::remove(file_name.c_str());
+   std::remove(index_name.c_str());
+
+   return result;
+}
+
+bool test_token_grid_append()
+{
+   std::srand(static_cast<unsigned int>(strtk::magic_seed));
+
+   for (std::size_t i = 0; i < 6; ++i)
    {
-      unsigned int t = 0;
+      const bool with_quotes = (1 == (i & 1));
+      const std::string s = random_dsv_string(50000 + std::rand() % 1000, with_quotes) + "\n";
 
-      for (std::size_t i = 0; i < bad_list_size; ++i)
+      strtk::token_grid::options options;
+      options.set_column_delimiters(",| ")
+             .set_structural_index(4 <= i);
+      options.support_dquotes = with_quotes;
+      options.trim_dquotes    = with_quotes;
+
+      strtk::token_grid grid0(s, s.size(), options);
+
+      // Grids 1 and 2 start empty and from a loaded prefix respectively.
+      const std::size_t prefix_size = (i < 2) ? 0 : s.size() / 3;
+
+      strtk::token_grid grid1(options);
+      strtk::token_grid grid2(s, prefix_size, options);
+
+      std::size_t position = prefix_size;
+
+      grid1.append(s.data(), prefix_size);
+
+      while (position < s.size())
       {
-         if (strtk::string_to_type_converter(bad_list[i],t))
-         {
-            std::cout << "test_int_uint_convert() - Failed bad test for uint @ " << i
-                      << " str: [" << bad_list[i] << "]" << std::endl;
+         const std::size_t size = std::min<std::size_t>(1 + std::rand() % 700, s.size() - position);
+
+         grid1.append(s.data() + position, size);
+         grid2.append(s.data() + position, size);
+
+         position += size;
 
+         if (grid1.row_count() != grid2.row_count())
+         {
+            std::cout << "test_token_grid_append() - Failed row count test: " << i << std::endl;
             return false;
          }
       }
+
+      if (
+           !token_grid_equal(grid0,grid1) ||
+           !token_grid_equal(grid0,grid2) ||
+           (0 != grid1.pending_append_size())
+         )
+      {
+         std::cout << "test_token_grid_append() - Failed comparison test: " << i << std::endl;
+         return false;
+      }
    }
 
    {
-      short t = 0;
+      strtk::token_grid::options options;
+      options.set_column_delimiters(",");
 
-      for (std::size_t i = 0; i < bad_list_size; ++i)
+      strtk::token_grid grid(options);
+
+      grid.append(std::string("1,2\n3,"));
+
+      if ((1 != grid.row_count()) || (2 != grid.pending_append_size()))
       {
-         if (strtk::string_to_type_converter(bad_list[i],t))
-         {
-            std::cout << "test_int_uint_convert() - Failed bad test for short @ " << i
-                      << " str: [" << bad_list[i] << "]" << std::endl;
+         std::cout << "test_token_grid_append() - Failed partial row test" << std::endl;
+         return false;
+      }
 
-            return false;
-         }
+      grid.append(std::string("4,5\n"));
+
+      if ((2 != grid.row_count()) || (3 != grid.max_column_count()) || (2 != grid.min_column_count()))
+      {
+         std::cout << "test_token_grid_append() - Failed row completion test" << std::endl;
+         return false;
       }
    }
 
    {
-      unsigned short t = 0;
+      // A long row arriving a byte at a time.
+      strtk::token_grid::options options;
+      options.set_column_delimiters(",");
 
-      for (std::size_t i = 0; i < bad_list_size; ++i)
+      strtk::token_grid grid(options);
+
+      for (std::size_t i = 0; i < 100000; ++i)
       {
-         if (strtk::string_to_type_converter(bad_list[i],t))
-         {
-            std::cout << "test_int_uint_convert() - Failed bad test for ushort @ " << i
-                      << " str: [" << bad_list[i] << "]" << std::endl;
+         grid.append((0 == (i % 10)) ? "," : "x", 1);
+      }
 
-            return false;
-         }
+      grid.append("\n", 1);
+
+      if ((1 != grid.row_count()) || (10001 != grid.max_column_count()) || (0 != grid.pending_append_size()))
+      {
+         std::cout << "test_token_grid_append() - Failed byte append test" << std::endl;
+         return false;
       }
    }
 
    {
-      const short int min_shrtint = std::numeric_limits<short int>::min();
-      const int       min_int     = std::numeric_limits<int      >::min();
-      const long long min_lnglng  = std::numeric_limits<long long>::min();
+      // Appending to a grid loaded (or mapped) from a file, which ends mid-row.
+      static const std::string file_name = "strtk_token_grid_append_test.txt";
 
-      const std::string min_shrtint_str = "-32768";
-      const std::string min_int_str     = "-2147483648";
-      const std::string min_lnglng_str  = "-9223372036854775808";
+      const std::string s = random_dsv_string(100000, true) + "\n";
+      const std::size_t prefix_size = s.size() / 2;
 
-      if (min_shrtint_str != strtk::type_to_string(min_shrtint))
       {
-         std::cout << "test_int_uint_convert() - Failed min short int to string conversion!  result:" << strtk::type_to_string(min_shrtint) << std::endl;
-         return false;
+         std::ofstream stream(file_name.c_str(),std::ios::binary);
+         stream.write(s.data(),static_cast<std::streamsize>(prefix_size));
       }
 
-      if (min_int_str != strtk::type_to_string(min_int))
+      strtk::token_grid::options options;
+      options.set_column_delimiters(",| ");
+      options.support_dquotes = true;
+      options.trim_dquotes    = true;
+
+      strtk::token_grid grid0(s, s.size(), options);
+      strtk::token_grid grid1(file_name, options.set_memory_map(true));
+
+      for (std::size_t position = prefix_size; position < s.size(); position += 1000)
       {
-         std::cout << "test_int_uint_convert() - Failed min int to string conversion!  result:" << strtk::type_to_string(min_int) << std::endl;
-         return false;
+         grid1.append(s.data() + position, std::min<std::size_t>(1000, s.size() - position));
       }
 
-      if (min_lnglng_str != strtk::type_to_string(min_lnglng))
+      bool result = token_grid_equal(grid0,grid1);
+
+      grid0.remove_row(grid0.row_count() / 3);
+      grid1.remove_row(grid1.row_count() / 3);
+      grid0.remove_row(grid0.row_count() - 2);
+      grid1.remove_row(grid1.row_count() - 2);
+
+      result &= token_grid_equal(grid0,grid1);
+
+      grid1.clear();
+      std::remove(file_name.c_str());
+
+      if (!result)
       {
-         std::cout << "test_int_uint_convert() - Failed min long long to string conversion!  result:" << strtk::type_to_string(min_lnglng) << std::endl;
+         std::cout << "test_token_grid_append() - Failed file append test" << std::endl;
          return false;
       }
    }
 
+   return true;
+}
+
+bool test_token_grid_memory_map()
+{
+   static const std::string file_name = "strtk_token_grid_mmap_test.txt";
+
+   std::srand(static_cast<unsigned int>(strtk::magic_seed));
+
+   const std::string s = random_dsv_string(100000, true);
+
+   {
+      std::ofstream stream(file_name.c_str(),std::ios::binary);
+      stream.write(s.data(),static_cast<std::streamsize>(s.size()));
+   }
+
+   strtk::token_grid::options options;
+   options.set_column_delimiters(",| ");
+   options.support_dquotes = true;
+
+   bool result = true;
+
    {
-      const short int          max_shrtint  = std::numeric_limits<short int         >::max();
-      const unsigned short int max_ushrtint = std::numeric_limits<unsigned short int>::max();
-      const int                max_int      = std::numeric_limits<int               >::max();
-      const unsigned int       max_uint     = std::numeric_limits<unsigned int      >::max();
-      const long long          max_lnglng   = std::numeric_limits<long long         >::max();
-      const unsigned long long max_ulnglng  = std::numeric_limits<unsigned long long>::max();
+      strtk::token_grid grid0(file_name, options);
+      strtk::token_grid grid1(file_name, options.set_memory_map(true));
 
-      const std::string max_shrtint_str  =                "32767";
-      const std::string max_ushrtint_str =                "65535";
-      const std::string max_int_str      =           "2147483647";
-      const std::string max_uint_str     =           "4294967295";
-      const std::string max_lnglng_str   =  "9223372036854775807";
-      const std::string max_ulnglng_str  = "18446744073709551615";
+      if (!grid0 || !grid1 || !token_grid_equal(grid0,grid1))
+      {
+         std::cout << "test_token_grid_memory_map() - Failed comparison test" << std::endl;
+         result = false;
+      }
 
-      if (max_shrtint_str != strtk::type_to_string(max_shrtint))
+      if (!grid1.load(file_name, options) || !token_grid_equal(grid0,grid1))
       {
-         std::cout << "test_int_uint_convert() - Failed max short int to string conversion! [1]  result:" << strtk::type_to_string(max_shrtint) << std::endl;
-         return false;
+         std::cout << "test_token_grid_memory_map() - Failed reload test" << std::endl;
+         result = false;
       }
 
-      if (max_ushrtint_str != strtk::type_to_string(max_ushrtint))
+      grid1.clear();
+   }
+
+   std::remove(file_name.c_str());
+
+   return result;
+}
+
+bool test_token_grid_compact_storage()
+{
+   static const std::string data = "a,b,c\n1,,3\nxy,,\n\"p\",q\n";
+
+   strtk::token_grid::options options;
+   options.set_column_delimiters(",");
+   options.set_column_split_option(strtk::split_options::default_mode);
+   options.support_dquotes = true;
+   options.trim_dquotes    = true;
+
+   strtk::token_grid grid(data, data.size(), options);
+
+   static const std::string expected_load[] = { "a|b|c", "1||3", "xy||", "p|q" };
+   static const std::string expected_remove[] = { "a|b|c", "xy", "p|q" };
+
+   bool result = true;
+
+   for (int pass = 0; pass < 2; ++pass)
+   {
+      const std::string* expected = (0 == pass) ? expected_load : expected_remove;
+      const std::size_t row_count = (0 == pass) ? 4 : 3;
+
+      if (row_count != grid.row_count())
       {
-         std::cout << "test_int_uint_convert() - Failed max unsigned short int to string conversion! [1]  result:" << strtk::type_to_string(max_ushrtint) << std::endl;
+         std::cout << "test_token_grid_compact_storage() - Failed row count, pass: " << pass << std::endl;
          return false;
       }
 
-      if (max_int_str != strtk::type_to_string(max_int))
+      for (std::size_t i = 0; i < row_count; ++i)
       {
-         std::cout << "test_int_uint_convert() - Failed max int to string conversion! [1]  result:" << strtk::type_to_string(max_int) << std::endl;
-         return false;
+         const strtk::token_grid::row_type row = grid.row(i);
+         std::string s;
+
+         for (std::size_t j = 0; j < row.size(); ++j)
+         {
+            if (j) s += '|';
+            s += row.get<std::string>(j);
+         }
+
+         if (expected[i] != s)
+         {
+            std::cout << "test_token_grid_compact_storage() - Failed row: " << i
+                      << " pass: " << pass
+                      << " expected: [" << expected[i] << "] got: [" << s << "]" << std::endl;
+            result = false;
+         }
       }
 
-      if (max_uint_str != strtk::type_to_string(max_uint))
+      if (0 == pass)
       {
-         std::cout << "test_int_uint_convert() - Failed max uint to string conversion! [1]  result:" << strtk::type_to_string(max_uint) << std::endl;
-         return false;
+         grid.remove_row(1);
+         grid.remove_empty_tokens();
       }
+   }
 
-      if (max_lnglng_str != strtk::type_to_string(max_lnglng))
+   return result;
+}
+
+bool test_token_grid_column_cache()
+{
+   static const std::string data = "1,1.5,x\n2,abc\n3,2.5,y\n4\n5,4.0,z\n";
+
+   strtk::token_grid::options options;
+   options.set_column_delimiters(",");
+
+   strtk::token_grid grid0(data, data.size(), options);
+   strtk::token_grid grid1(data, data.size(), options);
+   strtk::token_grid grid2(data, data.size(), options.set_column_cache(true));
+
+   const strtk::token_grid::typed_column<double>& column = grid1.column_cache<double>(1);
+
+   if (
+        (5 != column.size()) ||
+        !column.present(0) || !column.valid(0) || (1.5 != column.value(0)) ||
+        !column.present(1) ||  column.valid(1) ||
+        column.present(3)  ||  column.valid(3)
+      )
+   {
+      std::cout << "test_token_grid_column_cache() - Failed materialisation test" << std::endl;
+      return false;
+   }
+
+   if (&column != &grid1.column_cache<double>(1))
+   {
+      std::cout << "test_token_grid_column_cache() - Failed cache reuse test" << std::endl;
+      return false;
+   }
+
+   bool result = true;
+
+   for (std::size_t pass = 0; pass < 2; ++pass)
+   {
+      const strtk::token_grid::row_range_t range(2,grid0.row_count());
+
+      double sum[3] = { 0.0, 0.0, 0.0 };
+      std::size_t count[3] = { 0, 0, 0 };
+
+      count[0] = grid0.accumulate_column(1,range,sum[0]);
+      count[1] = grid1.accumulate_column(1,range,sum[1]);
+      count[2] = grid2.accumulate_column(1,range,sum[2]);
+
+      std::vector<double> column_values[3];
+
+      grid0.extract_column_checked(1,strtk::back_inserter_with_valuetype(column_values[0]));
+      grid1.extract_column_checked(1,strtk::back_inserter_with_valuetype(column_values[1]));
+      grid2.extract_column_checked(1,strtk::back_inserter_with_valuetype(column_values[2]));
+
+      for (std::size_t i = 1; i < 3; ++i)
       {
-         std::cout << "test_int_uint_convert() - Failed max long long to string conversion! [1]  result:" << strtk::type_to_string(max_lnglng) << std::endl;
-         return false;
+         if ((count[0] != count[i]) || (sum[0] != sum[i]) || (column_values[0] != column_values[i]))
+         {
+            std::cout << "test_token_grid_column_cache() - Failed comparison test, pass: " << pass << " grid: " << i << std::endl;
+            result = false;
+         }
       }
 
-      if (max_ulnglng_str != strtk::type_to_string(max_ulnglng))
+      if ((0 == pass) && ((3 != count[0]) || (6.5 != sum[0])))
       {
-         std::cout << "test_int_uint_convert() - Failed max long long to string conversion! [1]  result:" << strtk::type_to_string(max_ulnglng) << std::endl;
-         return false;
+         std::cout << "test_token_grid_column_cache() - Failed accumulate test" << std::endl;
+         result = false;
       }
 
-      if (max_shrtint != strtk::string_to_type_converter<short int>(max_shrtint_str))
-      {
-         std::cout << "test_int_uint_convert() - Failed string to max short int conversion! [1]  result:" << strtk::string_to_type_converter<short int>(max_shrtint_str) << std::endl;
-         return false;
-      }
+      grid0.remove_row(1);
+      grid1.remove_row(1);
+      grid2.remove_row(1);
+   }
+
+   return result;
+}
+
+struct even_first_column
+{
+   inline bool operator()(const strtk::token_grid::row_type& row) const
+   {
+      return (0 == (row.get<unsigned int>(0) & 1));
+   }
+};
+
+struct odd_first_column
+{
+   inline bool operator()(const strtk::token_grid::row_type& row) const
+   {
+      return (1 == (row.get<unsigned int>(0) & 1));
+   }
+};
+
+struct even_row_index
+{
+   inline bool operator()(const strtk::token_grid::row_type& row) const
+   {
+      return (0 == (row.index() & 1));
+   }
+};
+
+// Predicate with a non-const function call operator.
+struct counting_even_first_column
+{
+   counting_even_first_column()
+   : count(0)
+   {}
+
+   inline bool operator()(const strtk::token_grid::row_type& row)
+   {
+      ++count;
+      return (0 == (row.get<unsigned int>(0) & 1));
+   }
+
+   std::size_t count;
+};
+
+bool test_token_grid_parallel_column()
+{
+   std::string data;
+
+   for (std::size_t i = 0; i < 20000; ++i)
+   {
+      data += strtk::type_to_string(i) + "," + strtk::type_to_string(i * 3);
+
+      if (0 != (i % 7))
+         data += "," + strtk::type_to_string(i % 11);
+
+      data += "\n";
+   }
+
+   strtk::token_grid::options options;
+   options.set_column_delimiters(",");
+
+   strtk::token_grid grid0(data, data.size(), options);
+   strtk::token_grid grid1(data, data.size(), options.set_worker_count(4));
+   strtk::token_grid grid2(data, data.size(), options.set_column_cache(true));
+
+   bool result = true;
+
+   for (std::size_t i = 1; i < 3; ++i)
+   {
+      const strtk::token_grid& grid = (1 == i) ? grid1 : grid2;
+      const strtk::token_grid::row_range_t range(17,19500);
+
+      std::vector<unsigned int> column0;
+      std::vector<unsigned int> column1;
 
-      if (max_ushrtint != strtk::string_to_type_converter<unsigned short int>(max_ushrtint_str))
-      {
-         std::cout << "test_int_uint_convert() - Failed string to max short int conversion! [1]  result:" << strtk::string_to_type_converter<unsigned short int>(max_ushrtint_str) << std::endl;
-         return false;
-      }
+      grid0.extract_column(range,2,strtk::back_inserter_with_valuetype(column0));
+      grid.parallel_extract_column(range,2,strtk::back_inserter_with_valuetype(column1));
 
-      if (max_int != strtk::string_to_type_converter<int>(max_int_str))
-      {
-         std::cout << "test_int_uint_convert() - Failed string to max int conversion! [1]  result:" << strtk::string_to_type_converter<int>(max_int_str) << std::endl;
-         return false;
-      }
+      unsigned long long int sum[4] = { 0, 0, 0, 0 };
 
-      if (max_uint != strtk::string_to_type_converter<unsigned int>(max_uint_str))
-      {
-         std::cout << "test_int_uint_convert() - Failed string to max uint conversion! [1]  result:" << strtk::string_to_type_converter<unsigned int>(max_uint_str) << std::endl;
-         return false;
-      }
+      const std::size_t count0 = grid0.accumulate_column(2,range,sum[0]);
+      const std::size_t count1 = grid.parallel_accumulate_column(2,range,sum[1]);
+      const std::size_t count2 = grid0.accumulate_column(2,even_first_column(),sum[2]);
+      const std::size_t count3 = grid.parallel_accumulate_column(2,even_first_column(),sum[3]);
 
-      if (max_lnglng != strtk::string_to_type_converter<long long>(max_lnglng_str))
-      {
-         std::cout << "test_int_uint_convert() - Failed string to max long long conversion! [1]  result:" << strtk::string_to_type_converter<long long>(max_lnglng_str) << std::endl;
-         return false;
-      }
+      // Stateful predicates, over ranges above and below the partitioning threshold.
+      const strtk::token_grid::row_range_t small_range(17,117);
 
-      if (max_ulnglng != strtk::string_to_type_converter<unsigned long long>(max_ulnglng_str))
+      unsigned long long int stateful_sum[4] = { 0, 0, 0, 0 };
+
+      const std::size_t count4 = grid0.accumulate_column(2,range,counting_even_first_column(),stateful_sum[0]);
+      const std::size_t count5 = grid.parallel_accumulate_column(2,range,counting_even_first_column(),stateful_sum[1]);
+      const std::size_t count6 = grid0.accumulate_column(2,small_range,counting_even_first_column(),stateful_sum[2]);
+      const std::size_t count7 = grid.parallel_accumulate_column(2,small_range,counting_even_first_column(),stateful_sum[3]);
+
+      if (
+           (column0 != column1) || column0.empty() ||
+           (count0 != count1)   || (sum[0] != sum[1]) ||
+           (count2 != count3)   || (sum[2] != sum[3]) ||
+           (count4 != count5)   || (stateful_sum[0] != stateful_sum[1]) ||
+           (count6 != count7)   || (stateful_sum[2] != stateful_sum[3]) ||
+           (0 == count6)
+         )
       {
-         std::cout << "test_int_uint_convert() - Failed string to max long long conversion! [1]  result:" << strtk::string_to_type_converter<unsigned long long>(max_ulnglng_str) << std::endl;
-         return false;
+         std::cout << "test_token_grid_parallel_column() - Failed comparison test, grid: " << i << std::endl;
+         result = false;
       }
    }
 
    {
-      const short int min_shrtint  = std::numeric_limits<short int>::min();
-      const int       min_int      = std::numeric_limits<int      >::min();
-      const long long min_lnglng   = std::numeric_limits<long long>::min();
+      const std::string bad_data = data + "1,2,x\n";
 
-      const std::string min_shrtint_str  =               "-32768";
-      const std::string min_int_str      =          "-2147483648";
-      const std::string min_lnglng_str   = "-9223372036854775808";
+      strtk::token_grid grid(bad_data, bad_data.size(), options.set_column_cache(false));
 
-      if (min_shrtint_str != strtk::type_to_string(min_shrtint))
-      {
-         std::cout << "test_int_uint_convert() - Failed min short int to string conversion! [1]  result:" << strtk::type_to_string(min_shrtint) << std::endl;
-         return false;
-      }
+      unsigned long long int sum = 7;
 
-      if (min_int_str != strtk::type_to_string(min_int))
+      if ((0 != grid.parallel_accumulate_column(2,sum)) || (7 != sum))
       {
-         std::cout << "test_int_uint_convert() - Failed min int to string conversion! [1]  result:" << strtk::type_to_string(min_int) << std::endl;
-         return false;
+         std::cout << "test_token_grid_parallel_column() - Failed conversion failure test" << std::endl;
+         result = false;
       }
+   }
 
-      if (min_lnglng_str != strtk::type_to_string(min_lnglng))
-      {
-         std::cout << "test_int_uint_convert() - Failed min long long to string conversion! [1]  result:" << strtk::type_to_string(min_lnglng) << std::endl;
-         return false;
-      }
+   return result;
+}
 
-      if (min_shrtint != strtk::string_to_type_converter<short int>(min_shrtint_str))
-      {
-         std::cout << "test_int_uint_convert() - Failed string to min short int conversion! [1]  result:" << strtk::string_to_type_converter<short int>(min_shrtint_str) << std::endl;
-         return false;
-      }
+bool test_token_grid_group_by()
+{
+   static const char* key_list[] = { "red", "green", "blue", "cyan", "magenta" };
 
-      if (min_int != strtk::string_to_type_converter<int>(min_int_str))
-      {
-         std::cout << "test_int_uint_convert() - Failed string to min int conversion! [1]  result:" << strtk::string_to_type_converter<int>(min_int_str) << std::endl;
-         return false;
-      }
+   std::string data;
 
-      if (min_lnglng != strtk::string_to_type_converter<long long>(min_lnglng_str))
-      {
-         std::cout << "test_int_uint_convert() - Failed string to min long long conversion! [1]  result:" << strtk::string_to_type_converter<long long>(min_lnglng_str) << std::endl;
-         return false;
-      }
-   }
+   std::map<std::string,std::pair<std::size_t,long long int> > expected;
+   std::vector<std::string> expected_order;
 
+   for (std::size_t i = 0; i < 15000; ++i)
    {
-      std::string s1 =  "65536";
-      std::string s2 = "+65536";
-      std::string s3 =  "99999";
-      unsigned short t = 0;
+      const std::string key = key_list[(i * i) % 5];
 
-      if (strtk::string_to_type_converter(s1,t))
-      {
-         std::cout << "test_int_uint_convert() - Failed bad test for max1 ushort str: " << s << std::endl;
-         return false;
-      }
+      if (expected.end() == expected.find(key))
+         expected_order.push_back(key);
 
-      if (strtk::string_to_type_converter(s2,t))
-      {
-         std::cout << "test_int_uint_convert() - Failed bad test for max2 ushort str: " << s << std::endl;
-         return false;
-      }
+      expected[key].first  += 1;
+      expected[key].second += static_cast<long long int>(i % 101);
 
-      if (strtk::string_to_type_converter(s3,t))
-      {
-         std::cout << "test_int_uint_convert() - Failed bad test for extreme ushort str: " << s << std::endl;
-         return false;
-      }
+      data += key + "," + strtk::type_to_string(i % 101) + "," + strtk::type_to_string(i % 13) + "\n";
    }
 
-   {
-      std::string s1 = "-32769";
-      std::string s2 = "+32768";
-      std::string s3 =  "32768";
-      std::string s4 =  "99999";
-      short int t = 0;
+   data += "orphan\n";
+   expected_order.push_back("orphan");
 
-      if (strtk::string_to_type_converter(s1,t))
-      {
-         std::cout << "test_int_uint_convert() - Failed bad test for min short str: " << s << std::endl;
-         return false;
-      }
+   strtk::token_grid::options options;
+   options.set_column_delimiters(",");
 
-      if (strtk::string_to_type_converter(s2,t))
-      {
-         std::cout << "test_int_uint_convert() - Failed bad test for max1 short str: " << s << std::endl;
-         return false;
-      }
+   strtk::token_grid grid0(data, data.size(), options);
+   strtk::token_grid grid1(data, data.size(), options.set_worker_count(4));
 
-      if (strtk::string_to_type_converter(s3,t))
-      {
-         std::cout << "test_int_uint_convert() - Failed bad test for max2 short str: " << s << std::endl;
-         return false;
-      }
+   std::vector<std::size_t> value_col_list;
+   value_col_list.push_back(1);
+   value_col_list.push_back(2);
 
-      if (strtk::string_to_type_converter(s4,t))
-      {
-         std::cout << "test_int_uint_convert() - Failed bad test for extreme short str: " << s << std::endl;
-         return false;
-      }
+   std::vector<strtk::token_grid::group_aggregate<long long int> > group_list0;
+   std::vector<strtk::token_grid::group_aggregate<long long int> > group_list1;
+
+   bool result = true;
+
+   if (
+        !grid0.group_by(0,value_col_list,group_list0) ||
+        !grid1.parallel_group_by(0,value_col_list,group_list1) ||
+        (expected_order.size() != group_list0.size()) ||
+        (expected_order.size() != group_list1.size())
+      )
+   {
+      std::cout << "test_token_grid_group_by() - Failed group count test" << std::endl;
+      return false;
    }
 
+   for (std::size_t i = 0; i < group_list0.size(); ++i)
    {
-      std::string s1 =  "4294967296";
-      std::string s2 = "+4294967296";
-      std::string s3 =  "9999999999";
-      unsigned int t = 0;
+      const strtk::token_grid::group_aggregate<long long int>& g0 = group_list0[i];
+      const strtk::token_grid::group_aggregate<long long int>& g1 = group_list1[i];
 
-      if (strtk::string_to_type_converter(s1,t))
-      {
-         std::cout << "test_int_uint_convert() - Failed bad test for max1 uint str: " << s << std::endl;
-         return false;
-      }
+      const std::string key = g0.key_string();
 
-      if (strtk::string_to_type_converter(s2,t))
+      if ((key != expected_order[i]) || (key != g1.key_string()))
       {
-         std::cout << "test_int_uint_convert() - Failed bad test for max2 uint str: " << s << std::endl;
-         return false;
+         std::cout << "test_token_grid_group_by() - Failed group order test, group: " << i << std::endl;
+         result = false;
+         continue;
       }
 
-      if (strtk::string_to_type_converter(s3,t))
+      const std::size_t rows = ("orphan" == key) ? 1 : expected[key].first;
+      const long long int sum = ("orphan" == key) ? 0 : expected[key].second;
+
+      if (
+           (g0.row_count != rows) || (g1.row_count != rows) ||
+           (g0.column_list[0].sum != sum) || (g1.column_list[0].sum != sum) ||
+           (g0.column_list[1].sum   != g1.column_list[1].sum  ) ||
+           (g0.column_list[1].min   != g1.column_list[1].min  ) ||
+           (g0.column_list[1].max   != g1.column_list[1].max  ) ||
+           (g0.column_list[1].count != g1.column_list[1].count)
+         )
       {
-         std::cout << "test_int_uint_convert() - Failed bad test for extreme uint str: " << s << std::endl;
-         return false;
+         std::cout << "test_token_grid_group_by() - Failed aggregate test, group: " << key << std::endl;
+         result = false;
       }
    }
 
    {
-      std::string s1 = "-2147483649";
-      std::string s2 = "+2147483648";
-      std::string s3 =  "2147483648";
-      std::string s4 =  "9999999999";
-      int t = 0;
+      std::vector<strtk::token_grid::group_aggregate<int> > group_list;
 
-      if (strtk::string_to_type_converter(s1,t))
+      if (!grid0.group_by(0,1,group_list) || (group_list.size() != expected_order.size()))
       {
-         std::cout << "test_int_uint_convert() - Failed bad test for min int str: " << s1 << std::endl;
-         return false;
+         std::cout << "test_token_grid_group_by() - Failed single column test" << std::endl;
+         result = false;
       }
-
-      if (strtk::string_to_type_converter(s2,t))
+      else if ((0 != group_list[0].column_list[0].min) || (100 != group_list[0].column_list[0].max))
       {
-         std::cout << "test_int_uint_convert() - Failed bad test for max1 int str: " << s2 << std::endl;
-         return false;
+         std::cout << "test_token_grid_group_by() - Failed min/max test" << std::endl;
+         result = false;
       }
 
-      if (strtk::string_to_type_converter(s3,t))
+      if (grid0.group_by(7,1,group_list))
       {
-         std::cout << "test_int_uint_convert() - Failed bad test for max2 int str: " << s3 << std::endl;
-         return false;
+         std::cout << "test_token_grid_group_by() - Failed invalid key column test" << std::endl;
+         result = false;
       }
+   }
 
-      if (strtk::string_to_type_converter(s4,t))
-      {
-         std::cout << "test_int_uint_convert() - Failed bad test for extreme int str: " << s4 << std::endl;
-         return false;
-      }
+   return result;
+}
+
+bool profiles_equal(const strtk::token_grid::column_profile& p0,
+                    const strtk::token_grid::column_profile& p1)
+{
+   return (p0.token_count   == p1.token_count  ) &&
+          (p0.empty_count   == p1.empty_count  ) &&
+          (p0.min_width     == p1.min_width    ) &&
+          (p0.max_width     == p1.max_width    ) &&
+          (p0.numeric_count == p1.numeric_count) &&
+          (p0.numeric_min   == p1.numeric_min  ) &&
+          (p0.numeric_max   == p1.numeric_max  ) &&
+          (p0.register_list == p1.register_list) &&
+          (std::abs(p0.numeric_sum - p1.numeric_sum) < 1e-6 * (1.0 + std::abs(p0.numeric_sum)));
+}
+
+bool test_token_grid_column_profile()
+{
+   std::string data;
+
+   for (std::size_t i = 0; i < 30000; ++i)
+   {
+      data += strtk::type_to_string(i) + ",";
+
+      if (0 != (i % 10))
+         data += strtk::type_to_string(i % 500);
+
+      data += ",k" + strtk::type_to_string(i % 37) + "\n";
    }
 
+   strtk::token_grid::options options;
+   options.set_column_delimiters(",");
+   options.set_column_split_option(strtk::split_options::default_mode);
+   options.set_profile_columns(true);
+
+   strtk::token_grid grid0(data, data.size(), options);
+   strtk::token_grid grid1(data, data.size(), strtk::token_grid::options(options).set_worker_count(4));
+
+   const std::vector<strtk::token_grid::column_profile>& list0 = grid0.column_profiles();
+   const std::vector<strtk::token_grid::column_profile>& list1 = grid1.column_profiles();
+
+   if ((3 != list0.size()) || (3 != list1.size()))
    {
-      std::string s1 = "-0009223372036854775809";
-      std::string s2 = "+0009223372036854775808";
-      std::string s3 =  "0009223372036854775808";
-      std::string s4 =  "0009999999999999999999";
+      std::cout << "test_token_grid_column_profile() - Failed column count test" << std::endl;
+      return false;
+   }
 
-      long long t = 0;
+   bool result = true;
 
-      if (strtk::string_to_type_converter(s1,t))
+   for (std::size_t c = 0; c < list0.size(); ++c)
+   {
+      if (!profiles_equal(list0[c],list1[c]))
       {
-         std::cout << "test_int_uint_convert() - Failed bad test for min long long str: " << s1 << std::endl;
-         return false;
+         std::cout << "test_token_grid_column_profile() - Failed parallel comparison test, column: " << c << std::endl;
+         result = false;
       }
+   }
 
-      if (strtk::string_to_type_converter(s2,t))
-      {
-         std::cout << "test_int_uint_convert() - Failed bad test for max1 long long str: " << s2 << std::endl;
-         return false;
-      }
+   const strtk::token_grid::column_profile& p0 = list0[0];
+   const strtk::token_grid::column_profile& p1 = list0[1];
+   const strtk::token_grid::column_profile& p2 = list0[2];
 
-      if (strtk::string_to_type_converter(s3,t))
-      {
-         std::cout << "test_int_uint_convert() - Failed bad test for max2 long long str: " << s3 << std::endl;
-         return false;
-      }
+   if (
+        (30000 != p0.token_count) || (0 != p0.empty_count)  ||
+        (1 != p0.min_width)       || (5 != p0.max_width)    ||
+        (0.0 != p0.numeric_min)   || (29999.0 != p0.numeric_max) ||
+        (449985000.0 != p0.numeric_sum) || (1.0 != p0.numeric_ratio())
+      )
+   {
+      std::cout << "test_token_grid_column_profile() - Failed numeric column test" << std::endl;
+      result = false;
+   }
 
-      if (strtk::string_to_type_converter(s4,t))
-      {
-         std::cout << "test_int_uint_convert() - Failed bad test for extreme long long str: " << s4 << std::endl;
-         return false;
-      }
+   if ((3000 != p1.empty_count) || (0 != p1.min_width) || (3 != p1.max_width) || (499.0 != p1.numeric_max))
+   {
+      std::cout << "test_token_grid_column_profile() - Failed empty token test" << std::endl;
+      result = false;
    }
 
+   if ((0 != p2.numeric_count) || (0.0 != p2.numeric_ratio()))
    {
-      std::string s1 = "-00018446744073709551616";
-      std::string s2 = "+00018446744073709551616";
-      std::string s3 =  "00018446744073709551616";
-      std::string s4 =  "00099999999999999999999";
+      std::cout << "test_token_grid_column_profile() - Failed non-numeric column test" << std::endl;
+      result = false;
+   }
 
-      unsigned long long t = 0;
+   const std::size_t distinct[] = { 30000, 450, 37 };
 
-      if (strtk::string_to_type_converter(s1,t))
-      {
-         std::cout << "test_int_uint_convert() - Failed bad test for min unsigned long long str: " << s1 << std::endl;
-         return false;
-      }
+   for (std::size_t c = 0; c < 3; ++c)
+   {
+      const double error = std::abs(static_cast<double>(list0[c].distinct_count()) - distinct[c]) / distinct[c];
 
-      if (strtk::string_to_type_converter(s2,t))
+      if (error > 0.1)
       {
-         std::cout << "test_int_uint_convert() - Failed bad test for max1 unsigned long long str: " << s2 << std::endl;
-         return false;
+         std::cout << "test_token_grid_column_profile() - Failed distinct count test, column: " << c
+                   << " estimate: " << list0[c].distinct_count() << std::endl;
+         result = false;
       }
+   }
 
-      if (strtk::string_to_type_converter(s3,t))
+   for (std::size_t c = 0; c < 3; ++c)
+   {
+      if (grid0.column_width(c) != grid0.column_width(c,grid0.all_rows()))
       {
-         std::cout << "test_int_uint_convert() - Failed bad test for max2 unsigned long long str: " << s3 << std::endl;
-         return false;
+         std::cout << "test_token_grid_column_profile() - Failed column width test, column: " << c << std::endl;
+         result = false;
       }
+   }
 
-      if (strtk::string_to_type_converter(s4,t))
+   {
+      grid0.remove_row_if(odd_first_column());
+
+      std::string even_data;
+
+      for (std::size_t i = 0; i < 30000; i += 2)
       {
-         std::cout << "test_int_uint_convert() - Failed bad test for extreme unsigned long long str: " << s4 << std::endl;
-         return false;
+         even_data += strtk::type_to_string(i) + ",";
+
+         if (0 != (i % 10))
+            even_data += strtk::type_to_string(i % 500);
+
+         even_data += ",k" + strtk::type_to_string(i % 37) + "\n";
       }
-   }
 
-   return true;
-}
+      strtk::token_grid grid2(even_data, even_data.size(), options);
 
-bool test_parse1()
-{
-   std::string data = "1 ,|\t987.654 ,|\t abc ,|\t";
-   int i = 0;
-   double d = 0;
-   std::string s;
+      const std::vector<strtk::token_grid::column_profile>& list2 = grid0.column_profiles();
+      const std::vector<strtk::token_grid::column_profile>& list3 = grid2.column_profiles();
 
-   if (!strtk::parse(data, ",|\t ", i, d, s))
-   {
-      std::cout << "test_parse() - parse fail 1" << std::endl;
-      return false;
+      if (
+           (list2.size() != list3.size()) ||
+           !profiles_equal(list2[0],list3[0]) ||
+           !profiles_equal(list2[1],list3[1]) ||
+           !profiles_equal(list2[2],list3[2])
+         )
+      {
+         std::cout << "test_token_grid_column_profile() - Failed reprofile test" << std::endl;
+         result = false;
+      }
    }
 
-   if ((i != 1) || (d != 987.654) || (s != "abc"))
+   return result;
+}
+
+struct join_collector
+{
+   join_collector(std::vector<std::string>& list)
+   : output_list(list)
+   {}
+
+   inline void operator()(const strtk::token_grid::row_type& left,
+                          const strtk::token_grid::row_type& right)
    {
-      std::cout << "test_parse() - parse fail 2" << std::endl;
-      return false;
+      output_list.push_back(left.as_string() + "|" + ((0 != right.size()) ? right.as_string() : std::string("null")));
    }
 
-   return true;
-}
+   std::vector<std::string>& output_list;
+};
 
-bool test_parse2()
+bool test_token_grid_hash_join()
 {
-   std::string data = "1 ,|\t2. ,|\t 3.3 ,|\t .4 ,|\t 123.456 ,|\t 3.30 ,|\t 1.0e+010 ,|\t 2.2e+11 ,|\t 3.0E+012 ,|\t 4.4E+13";
+   std::string left_data;
+   std::string right_data;
 
-   double d[10] = { 0.0 };
+   for (std::size_t i = 0; i < 6000; ++i)
+   {
+      left_data += "id" + strtk::type_to_string(i) + ",name" + strtk::type_to_string(i) + "\n";
+   }
 
-   if (!strtk::parse(data, ",|\t ", d[0], d[1], d[2], d[3], d[4], d[5], d[6], d[7], d[8], d[9]))
+   for (std::size_t i = 0; i < 9000; ++i)
    {
-      std::cout << "test_parse2() - parse double fail" << std::endl;
-      return false;
+      right_data += strtk::type_to_string(i % 3) + ",id" + strtk::type_to_string((i * 7) % 8000) + "\n";
    }
 
-   if (not_equal(d[0],      1.0)) { std::cout << "test_parse2() double check0 " << std::endl; return false; }
-   if (not_equal(d[1],      2.0)) { std::cout << "test_parse2() double check1 " << std::endl; return false; }
-   if (not_equal(d[2],      3.3)) { std::cout << "test_parse2() double check2 " << std::endl; return false; }
-   if (not_equal(d[3],      0.4)) { std::cout << "test_parse2() double check3 " << std::endl; return false; }
-   if (not_equal(d[4],  123.456)) { std::cout << "test_parse2() double check4 " << std::endl; return false; }
-   if (not_equal(d[5],      3.3)) { std::cout << "test_parse2() double check5 " << std::endl; return false; }
-   if (not_equal(d[6], 1.0e+010)) { std::cout << "test_parse2() double check6 " << std::endl; return false; }
-   if (not_equal(d[7], 2.2e+011)) { std::cout << "test_parse2() double check7 " << std::endl; return false; }
-   if (not_equal(d[8], 3.0e+012)) { std::cout << "test_parse2() double check8 " << std::endl; return false; }
-   if (not_equal(d[9], 4.4e+013)) { std::cout << "test_parse2() double check9 " << std::endl; return false; }
+   right_data += "orphan\n";
 
-   float f[10]  = { 0.0 };
+   strtk::token_grid::options options;
+   options.set_column_delimiters(",");
 
-   if (!strtk::parse(data, ",|\t ", f[0], f[1], f[2], f[3], f[4], f[5], f[6], f[7], f[8], f[9]))
+   strtk::token_grid left0 (left_data , left_data .size(), options);
+   strtk::token_grid right0(right_data, right_data.size(), options);
+   strtk::token_grid left1 (left_data , left_data .size(), strtk::token_grid::options(options).set_worker_count(4));
+
+   std::multimap<std::string,std::string> right_map;
+
+   for (std::size_t i = 0; i < right0.row_count(); ++i)
    {
-      std::cout << "test_parse2() - parse float fail" << std::endl;
-      return false;
+      const strtk::token_grid::row_type row = right0.row(i);
+
+      if (row.size() > 1)
+         right_map.insert(std::make_pair(row.get<std::string>(1),row.as_string()));
    }
 
-   if (not_equal(f[0],      1.0f)) { std::cout << "test_parse2() float check0 " << std::endl; return false; }
-   if (not_equal(f[1],      2.0f)) { std::cout << "test_parse2() float check1 " << std::endl; return false; }
-   if (not_equal(f[2],      3.3f)) { std::cout << "test_parse2() float check2 " << std::endl; return false; }
-   if (not_equal(f[3],      0.4f)) { std::cout << "test_parse2() float check3 " << std::endl; return false; }
-   if (not_equal(f[4],  123.456f)) { std::cout << "test_parse2() float check4 " << std::endl; return false; }
-   if (not_equal(f[5],      3.3f)) { std::cout << "test_parse2() float check5 " << std::endl; return false; }
-   if (not_equal(f[6], 1.0e+010f)) { std::cout << "test_parse2() float check6 " << std::endl; return false; }
-   if (not_equal(f[7], 2.2e+011f)) { std::cout << "test_parse2() float check7 " << std::endl; return false; }
-   if (not_equal(f[8], 3.0e+012f)) { std::cout << "test_parse2() float check8 " << std::endl; return false; }
-   if (not_equal(f[9], 4.4e+013f)) { std::cout << "test_parse2() float check9 " << std::endl; return false; }
+   std::vector<std::string> expected_inner;
+   std::vector<std::string> expected_outer;
 
-   return true;
-}
+   for (std::size_t i = 0; i < left0.row_count(); ++i)
+   {
+      const strtk::token_grid::row_type row = left0.row(i);
 
-bool test_parse3()
-{
+      typedef std::multimap<std::string,std::string>::const_iterator itr_t;
+      const std::pair<itr_t,itr_t> match = right_map.equal_range(row.get<std::string>(0));
 
-   std::string data = "123.456e3,123.456E3 123.456e+3,123.456E+3 123.456e03              "
-                      "123.456E03, 123.456e+03 123.456E+03,123.456e0003|123.456E0003,    "
-                      "123.456e+0003 123.456E+0003,|123.4560e3 123.45600E3, 123.456000e+3"
-                      "123.456000E+3,|123.4560000e03 123.45600000E03, 123.456000000e+03  "
-                      "123.4560000000E+03,123.45600000000e0003|123.456000000000E0003,    "
-                      "123.4560000000000e+0003 123.45600000000000E+0003                  "
-                      "0123.456e+003 00123.456E+003,| 000123.45600E3, 000000123.456e+0003";
+      if (match.first == match.second)
+         expected_outer.push_back(row.as_string() + "|null");
 
-   std::vector<double> double_list;
+      for (itr_t itr = match.first; itr != match.second; ++itr)
+      {
+         expected_inner.push_back(row.as_string() + "|" + itr->second);
+         expected_outer.push_back(row.as_string() + "|" + itr->second);
+      }
+   }
 
-   bool result = true;
+   std::sort(expected_inner.begin(),expected_inner.end());
 
-   if (!strtk::parse(data,",|\t ",double_list))
-   {
-      std::cout << "test_parse2() - parse double fail" << std::endl;
-      return false;
-   }
+   bool result = true;
 
-   for (std::size_t i = 0; i < double_list.size(); ++i)
+   for (std::size_t i = 0; i < 2; ++i)
    {
-      if (123.456e3 != double_list[i])
+      const strtk::token_grid& left = (0 == i) ? left0 : left1;
+
+      std::vector<std::string> inner0;
+      std::vector<std::string> inner1;
+      std::vector<std::string> inner2;
+      std::vector<std::string> outer0;
+      std::vector<std::string> outer1;
+
+      const std::size_t inner_count0 = left  .hash_join         (0,right0,1,join_collector(inner0));
+      const std::size_t inner_count1 = left  .parallel_hash_join(0,right0,1,join_collector(inner1));
+      const std::size_t inner_count2 = right0.hash_join         (1,left  ,0,join_collector(inner2));
+
+      left.hash_join         (0,right0,1,join_collector(outer0),strtk::token_grid::e_left_outer_join);
+      left.parallel_hash_join(0,right0,1,join_collector(outer1),strtk::token_grid::e_left_outer_join);
+
+      if (
+           (inner_count0 != expected_inner.size()) ||
+           (inner_count1 != expected_inner.size()) ||
+           (inner_count2 != expected_inner.size())
+         )
       {
-         std::cout << "test_parse3() double check[" << i << "] ";
-         printf("value: %30.20f\n",double_list[i]);
+         std::cout << "test_token_grid_hash_join() - Failed inner join count test, grid: " << i << std::endl;
          result = false;
+         continue;
       }
-   }
 
-   std::vector<float> float_list;
+      std::sort(inner0.begin(),inner0.end());
+      std::sort(inner1.begin(),inner1.end());
 
-   if (!strtk::parse(data,",|\t ",float_list))
-   {
-      std::cout << "test_parse3() - parse float fail." << std::endl;
-      result = false;
-   }
+      if ((inner0 != expected_inner) || (inner1 != expected_inner))
+      {
+         std::cout << "test_token_grid_hash_join() - Failed inner join test, grid: " << i << std::endl;
+         result = false;
+      }
 
-   for (std::size_t i = 0; i < float_list.size(); ++i)
-   {
-      if (123.456e3f != float_list[i])
+      if ((outer0 != expected_outer) || (outer1 != expected_outer))
       {
-         std::cout << "test_parse3() float check[" << i << "] ";
-         printf("value: %20.10f\n",float_list[i]);
+         std::cout << "test_token_grid_hash_join() - Failed left outer join test, grid: " << i << std::endl;
          result = false;
       }
    }
 
-   return  result;
+   return result;
 }
 
-bool test_parse4()
+std::string token_grid_row_string(const strtk::token_grid::row_type& row)
 {
+   std::string s;
+
+   for (std::size_t c = 0; c < row.size(); ++c)
    {
-      std::string data = "0,1,2,3|+0,+1,+2,+3|-0,-1,-2,-3";
-      strtk::vector_sink<int>::type vec_sink(",");
-      strtk::deque_sink<int>::type deq_sink(",");
-      strtk::list_sink<int>::type lst_sink(",");
+      if (c) s += '|';
+      s += row.get<std::string>(c);
+   }
 
-      std::vector<int> int_vec;
-      std::deque<int> int_deq;
-      std::list<int> int_lst;
+   return s;
+}
 
-      strtk::parse(data,"|",vec_sink(int_vec),
-                            deq_sink(int_deq),
-                            lst_sink(int_lst));
+struct row_string_collector
+{
+   row_string_collector(std::vector<std::string>& rows)
+   : rows_(rows)
+   {}
 
-      if (4 != int_vec.size())
-      {
-         std::cout << "test_parse4() - failed int_vec.size()" << std::endl;
-         return false;
-      }
+   inline void operator()(const strtk::token_grid::row_type& row)
+   {
+      rows_.push_back(token_grid_row_string(row));
+   }
 
-      if (4 != int_deq.size())
-      {
-         std::cout << "test_parse4() - failed int_deq.size()" << std::endl;
-         return false;
-      }
+   std::vector<std::string>& rows_;
+};
 
-      if (4 != int_lst.size())
+struct partition_string_collector
+{
+   partition_string_collector(std::vector<std::string>& partitions)
+   : partitions_(partitions)
+   {}
+
+   inline bool operator()(strtk::token_grid& grid, const strtk::token_grid::row_range_t& range)
+   {
+      std::string s;
+
+      for (std::size_t r = range.first; r < range.second; ++r)
       {
-         std::cout << "test_parse4() - failed int_lst.size()" << std::endl;
-         return false;
+         s += token_grid_row_string(grid.row(r)) + "\n";
       }
 
-      std::list<int>::iterator int_lst_itr = int_lst.begin();
+      partitions_.push_back(s);
 
-      for (int i = 0; i <= 3; ++i)
-      {
-         if (int_vec[i] != i)
-         {
-            std::cout << "test_parse4() - failed int_vec[" << i <<"] == " << i << std::endl;
-            return false;
-         }
+      return true;
+   }
 
-         if (int_deq[i] != i)
-         {
-            std::cout << "test_parse4() - failed int_deq[" << i <<"] == " << i << std::endl;
-            return false;
-         }
+   std::vector<std::string>& partitions_;
+};
 
-         if (*(int_lst_itr) != -i)
-         {
-            std::cout << "test_parse4() - failed int_lst[" << i <<"] == " << i << std::endl;
-            return false;
-         }
-         else
-            ++int_lst_itr;
-      }
+struct partition_transition
+{
+   inline bool operator()(const strtk::token_grid::row_type& row) const
+   {
+      return ('a' == (*row.token(0).first));
    }
+};
 
+struct counting_partition_transition
+{
+   counting_partition_transition(std::size_t& count)
+   : count_(count)
+   {}
+
+   inline bool operator()(const strtk::token_grid::row_type& row) const
    {
-      std::string data = "0.0,1.1,2.2,3.3|+0.0,+1.1,+2.2,+3.3|-0.0,-1.1,-2.2,-3.3";
-      strtk::vector_sink<double>::type vec_sink(",");
-      strtk::deque_sink<double>::type  deq_sink(",");
-      strtk::list_sink<double>::type  lst_sink(",");
+      ++count_;
+      return ('a' == (*row.token(0).first));
+   }
 
-      std::vector<double> double_vec;
-      std::deque<double> double_deq;
-      std::list<double> double_lst;
+   std::size_t& count_;
+};
 
-      strtk::parse(data,"|",vec_sink(double_vec),
-                            deq_sink(double_deq),
-                            lst_sink(double_lst));
+bool test_token_grid_deferred_removal()
+{
+   std::string data;
 
-      if (4 != double_vec.size())
-      {
-         std::cout << "test_parse4() - failed int_vec.size()" << std::endl;
-         return false;
-      }
+   for (std::size_t i = 0; i < 5000; ++i)
+   {
+      data += strtk::type_to_string(i) + "," + strtk::type_to_string(i * 2);
 
-      if (4 != double_deq.size())
-      {
-         std::cout << "test_parse4() - failed int_deq.size()" << std::endl;
-         return false;
-      }
+      if (0 != (i % 3))
+         data += ",x";
 
-      if (4 != double_lst.size())
-      {
-         std::cout << "test_parse4() - failed int_lst.size()" << std::endl;
-         return false;
-      }
+      data += "\n";
+   }
 
-      std::list<double>::iterator double_lst_itr = double_lst.begin();
+   strtk::token_grid::options options;
+   options.set_column_delimiters(",");
 
-      for (int i = 0; i <= 3; ++i)
-      {
-         const double expected_value = i + (i / 10.0);
+   strtk::token_grid grid0(data, data.size(), options);
+   strtk::token_grid grid1(data, data.size(), options.set_deferred_removal(true));
 
-         if (not_equal(double_vec[i],expected_value))
-         {
-            std::cout << "test_parse4() - failed double_vec[" << i <<"] == " << i << std::endl;
-            return false;
-         }
+   grid0.remove_row(10);
+   grid0.remove_row(10);
+   grid0.remove_row_if(odd_first_column());
 
-         if (not_equal(double_deq[i],expected_value))
-         {
-            std::cout << "test_parse4() - failed double_deq[" << i <<"] == " << i << std::endl;
-            return false;
-         }
+   grid1.remove_row(10);
+   grid1.remove_row(10);
+   grid1.remove_row_if(odd_first_column());
 
-         if (not_equal(*(double_lst_itr),-expected_value))
-         {
-            std::cout << "test_parse4() - failed double_lst[" << i <<"] == " << i << std::endl;
-            return false;
-         }
-         else
-            ++double_lst_itr;
+   bool result = true;
+
+   {
+      std::vector<std::string> rows0;
+      std::vector<std::string> rows1;
+
+      grid0.for_each_row(row_string_collector(rows0));
+      grid1.for_each_row(row_string_collector(rows1));
+
+      std::vector<unsigned int> column0;
+      std::vector<unsigned int> column1;
+
+      grid0.extract_column(1,strtk::back_inserter_with_valuetype(column0));
+      grid1.extract_column(1,strtk::back_inserter_with_valuetype(column1));
+
+      unsigned long long int sum0 = 0;
+      unsigned long long int sum1 = 0;
+
+      const std::size_t count0 = grid0.accumulate_column(1,sum0);
+      const std::size_t count1 = grid1.accumulate_column(1,sum1);
+
+      if (
+           (rows0 != rows1)     || (column0 != column1) ||
+           (count0 != count1)   || (sum0 != sum1)       ||
+           (grid0.row_count() != grid1.row_count())     ||
+           (2501 != grid1.removed_row_count())
+         )
+      {
+         std::cout << "test_token_grid_deferred_removal() - Failed deferred iteration test" << std::endl;
+         result = false;
       }
    }
 
-   return true;
-}
-
-namespace test_details
-{
-   struct data_store
    {
-      static const std::size_t member_count = 11;
+      bool rows_equal = token_grid_equal(grid0,grid1);
 
-      data_store()
-      :   c(0),
-         uc(0),
-          s(0),
-         us(0),
-          i(0),
-         ui(0),
-         ll(0),
-        ull(0),
-        d(0.0),
-        f(0.0),
-       str("")
-      {}
+      for (std::size_t i = 0; rows_equal && (i < grid0.row_count()); ++i)
+      {
+         std::string row0;
+         std::string row1;
 
-      char                 c;
-      unsigned char       uc;
-      short                s;
-      unsigned short      us;
-      int                  i;
-      unsigned int        ui;
-      long long           ll;
-      unsigned long long ull;
-      double               d;
-      float                f;
-      std::string        str;
+         rows_equal = grid0.join_row(i,"|",row0) &&
+                      grid1.join_row(i,"|",row1) &&
+                      (row0 == row1)             &&
+                      (i == grid1.row(i).index());
+      }
+
+      unsigned long long int sum0 = 0;
+      unsigned long long int sum1 = 0;
+
+      rows_equal = rows_equal &&
+                   (grid0.accumulate_column(1,even_row_index(),sum0) == grid1.accumulate_column(1,even_row_index(),sum1)) &&
+                   (sum0 == sum1);
+
+      if (!rows_equal || (2501 != grid1.removed_row_count()))
+      {
+         std::cout << "test_token_grid_deferred_removal() - Failed deferred row index test" << std::endl;
+         result = false;
+      }
+   }
 
-   };
-}
+   grid1.compact();
 
-bool test_kv_parse()
-{
+   if (!token_grid_equal(grid0,grid1) || (0 != grid1.removed_row_count()))
    {
-      static const std::size_t rounds = 20000000;
+      std::cout << "test_token_grid_deferred_removal() - Failed compaction test" << std::endl;
+      result = false;
+   }
 
-      std::string slist[] =
-      {
-         "A",
-         "z",
-         "-123",
-         "456",
-         "-12345678",
-         "789012345",
-         "-43654364634645235",
-         "777777777777777777",
-         "1234.56789",
-         "0.0003f",
-         "abcdefghijklmnopqrstuvwxyz",
-      };
+   {
+      strtk::token_grid grid2(data, data.size(), options.set_compaction_threshold(0.5));
 
-      test_details::data_store ds;
-      strtk::util::value v1;
-      strtk::util::value v2;
+      grid2.remove_row_range(strtk::token_grid::row_range_t(0,2499));
 
-      for (std::size_t i = 0; i < rounds; ++i)
+      const bool deferred = (2499 == grid2.removed_row_count()) && (2501 == grid2.row_count());
+
+      grid2.remove_row(0);
+
+      if (!deferred || (0 != grid2.removed_row_count()) || (2500 != grid2.row_count()) || (2500 != grid2.row(0).get<unsigned int>(0)))
       {
-         v1.assign(ds.  c); if (!v1(slist[ 0])) { std::cout << "Failed parsing slist[00] via v1!" << std::endl; return false; }
-         v1.assign(ds. uc); if (!v1(slist[ 1])) { std::cout << "Failed parsing slist[01] via v1!" << std::endl; return false; }
-         v1.assign(ds.  s); if (!v1(slist[ 2])) { std::cout << "Failed parsing slist[02] via v1!" << std::endl; return false; }
-         v1.assign(ds. us); if (!v1(slist[ 3])) { std::cout << "Failed parsing slist[03] via v1!" << std::endl; return false; }
-         v1.assign(ds.  i); if (!v1(slist[ 4])) { std::cout << "Failed parsing slist[04] via v1!" << std::endl; return false; }
-         v1.assign(ds. ui); if (!v1(slist[ 5])) { std::cout << "Failed parsing slist[05] via v1!" << std::endl; return false; }
-         v1.assign(ds. ll); if (!v1(slist[ 6])) { std::cout << "Failed parsing slist[06] via v1!" << std::endl; return false; }
-         v1.assign(ds.ull); if (!v1(slist[ 7])) { std::cout << "Failed parsing slist[07] via v1!" << std::endl; return false; }
-         v1.assign(ds.  d); if (!v1(slist[ 8])) { std::cout << "Failed parsing slist[08] via v1!" << std::endl; return false; }
-         v1.assign(ds.  f); if (!v1(slist[ 9])) { std::cout << "Failed parsing slist[09] via v1!" << std::endl; return false; }
-         v1.assign(ds.str); if (!v1(slist[10])) { std::cout << "Failed parsing slist[10] via v1!" << std::endl; return false; }
+         std::cout << "test_token_grid_deferred_removal() - Failed threshold compaction test" << std::endl;
+         result = false;
+      }
+   }
 
-         if ('A'                          != ds.  c) { std::cout << "Failed check v1 for ds.  c!" << std::endl; return false; }
-         if ('z'                          != ds. uc) { std::cout << "Failed check v1 for ds. uc!" << std::endl; return false; }
-         if (-123                         != ds.  s) { std::cout << "Failed check v1 for ds.  s!" << std::endl; return false; }
-         if (456                          != ds. us) { std::cout << "Failed check v1 for ds. us!" << std::endl; return false; }
-         if (-12345678                    != ds.  i) { std::cout << "Failed check v1 for ds.  i!" << std::endl; return false; }
-         if (789012345                    != ds. ui) { std::cout << "Failed check v1 for ds. ui!" << std::endl; return false; }
-         if (-43654364634645235LL         != ds. ll) { std::cout << "Failed check v1 for ds. ll!" << std::endl; return false; }
-         if (777777777777777777LL         != ds.ull) { std::cout << "Failed check v1 for ds.ull!" << std::endl; return false; }
-         if (1234.56789                   != ds.  d) { std::cout << "Failed check v1 for ds.  d!" << std::endl; return false; }
-         if (0.0003f                      != ds.  f) { std::cout << "Failed check v1 for ds.  f!" << std::endl; return false; }
-         if ("abcdefghijklmnopqrstuvwxyz" != ds.str) { std::cout << "Failed check v1 for ds.str!" << std::endl; return false; }
+   {
+      static const std::string data3 = "a\nb,c\nd,e,f\ng,h\n";
 
-         v2 = v1;
+      strtk::token_grid grid3(data3, data3.size(), options.set_compaction_threshold(0.0));
 
-         v2.assign(ds.  c); if (!v2(slist[ 0])) { std::cout << "Failed parsing slist[00] via v2!" << std::endl; return false; }
-         v2.assign(ds. uc); if (!v2(slist[ 1])) { std::cout << "Failed parsing slist[01] via v2!" << std::endl; return false; }
-         v2.assign(ds.  s); if (!v2(slist[ 2])) { std::cout << "Failed parsing slist[02] via v2!" << std::endl; return false; }
-         v2.assign(ds. us); if (!v2(slist[ 3])) { std::cout << "Failed parsing slist[03] via v2!" << std::endl; return false; }
-         v2.assign(ds.  i); if (!v2(slist[ 4])) { std::cout << "Failed parsing slist[04] via v2!" << std::endl; return false; }
-         v2.assign(ds. ui); if (!v2(slist[ 5])) { std::cout << "Failed parsing slist[05] via v2!" << std::endl; return false; }
-         v2.assign(ds. ll); if (!v2(slist[ 6])) { std::cout << "Failed parsing slist[06] via v2!" << std::endl; return false; }
-         v2.assign(ds.ull); if (!v2(slist[ 7])) { std::cout << "Failed parsing slist[07] via v2!" << std::endl; return false; }
-         v2.assign(ds.  d); if (!v2(slist[ 8])) { std::cout << "Failed parsing slist[08] via v2!" << std::endl; return false; }
-         v2.assign(ds.  f); if (!v2(slist[ 9])) { std::cout << "Failed parsing slist[09] via v2!" << std::endl; return false; }
-         v2.assign(ds.str); if (!v2(slist[10])) { std::cout << "Failed parsing slist[10] via v2!" << std::endl; return false; }
+      grid3.remove_row(0);
 
-         if ('A'                          != ds.  c) { std::cout << "Failed check v2 for ds.  c!" << std::endl; return false; }
-         if ('z'                          != ds. uc) { std::cout << "Failed check v2 for ds. uc!" << std::endl; return false; }
-         if (-123                         != ds.  s) { std::cout << "Failed check v2 for ds.  s!" << std::endl; return false; }
-         if (456                          != ds. us) { std::cout << "Failed check v2 for ds. us!" << std::endl; return false; }
-         if (-12345678                    != ds.  i) { std::cout << "Failed check v2 for ds.  i!" << std::endl; return false; }
-         if (789012345                    != ds. ui) { std::cout << "Failed check v2 for ds. ui!" << std::endl; return false; }
-         if (-43654364634645235LL         != ds. ll) { std::cout << "Failed check v2 for ds. ll!" << std::endl; return false; }
-         if (777777777777777777LL         != ds.ull) { std::cout << "Failed check v2 for ds.ull!" << std::endl; return false; }
-         if (1234.56789                   != ds.  d) { std::cout << "Failed check v2 for ds.  d!" << std::endl; return false; }
-         if (0.0003f                      != ds.  f) { std::cout << "Failed check v2 for ds.  f!" << std::endl; return false; }
-         if ("abcdefghijklmnopqrstuvwxyz" != ds.str) { std::cout << "Failed check v2 for ds.str!" << std::endl; return false; }
+      const bool min_removed = (2 == grid3.min_column_count()) && (3 == grid3.max_column_count());
+
+      grid3.remove_row(1);
 
+      std::string row;
+
+      if (
+           !min_removed                       ||
+           (2 != grid3.min_column_count())    ||
+           (2 != grid3.max_column_count())    ||
+           !grid3.join_row(1,",",row)         ||
+           ("g,h" != row)                     ||
+           (2 != grid3.removed_row_count())
+         )
+      {
+         std::cout << "test_token_grid_deferred_removal() - Failed deferred min/max column count test" << std::endl;
+         result = false;
       }
    }
 
    {
-      std::string s;
-      s.reserve(strtk::one_kilobyte);
-      std::pair<const char*, const char*> p;
+      strtk::token_grid grid4(data, data.size(), options);
 
-      for (int i = -10000000; i < +10000000; ++i)
-      {
-         strtk::type_to_string(i,s);
-         p = strtk::make_pair<const char*>(s);
-         int x = 0;
-         strtk::util::value v(x);
+      grid4.remove_row_if(odd_first_column());
 
-         if (!v(p))
-         {
-            std::cout << "test_kv_parse() - (int) failed parse at index: " << i << std::endl;
-            return false;
-         }
+      const strtk::token_grid::typed_column<unsigned int>& column = grid4.column_cache<unsigned int>(0);
 
-         if (x != i)
-         {
-            std::cout << "test_kv_parse() - (int) failed value test at index: " << i << " x:" << x << std::endl;
-            return false;
-         }
+      bool cache_equal = (grid4.row_count() == column.size());
+
+      for (std::size_t i = 0; cache_equal && (i < column.size()); ++i)
+      {
+         cache_equal = column.valid(i) && (grid4.row(i).get<unsigned int>(0) == column.value(i));
+      }
+
+      if (!cache_equal || (0 != grid4.removed_row_count()))
+      {
+         std::cout << "test_token_grid_deferred_removal() - Failed deferred column cache test" << std::endl;
+         result = false;
       }
    }
 
-   {
-      std::string s;
-      s.reserve(strtk::one_kilobyte);
-      std::pair<const char*, const char*> p;
+   return result;
+}
 
-      for (unsigned int i = 0; i < 20000000; ++i)
-      {
-         strtk::type_to_string(i,s);
-         p = strtk::make_pair<const char*>(s);
-         unsigned int x = 0;
-         strtk::util::value v(x);
+bool test_streaming_token_grid()
+{
+   static const std::string file_name = "strtk_streaming_token_grid_test.txt";
 
-         if (!v(p))
-         {
-            std::cout << "test_kv_parse() - (unsigned int) failed parse at index: " << i << std::endl;
-            return false;
-         }
+   std::srand(static_cast<unsigned int>(strtk::magic_seed));
 
-         if (x != i)
-         {
-            std::cout << "test_kv_parse() - (unsigned int) failed value test at index: " << i << " x:" << x << std::endl;
-            return false;
-         }
-      }
+   std::string s = random_dsv_string(50000, false);
+   s += "\n" + std::string(3000,'b') + "," + std::string(2000,'c') + "\n";
+   s += random_dsv_string(10000, false);
+
+   {
+      std::ofstream stream(file_name.c_str(),std::ios::binary);
+      stream.write(s.data(),static_cast<std::streamsize>(s.size()));
    }
 
+   strtk::token_grid::options options;
+   options.set_column_delimiters(",| ");
+
+   bool result = true;
+
    {
-      std::string s;
-      s.reserve(strtk::one_kilobyte);
-      std::pair<const char*, const char*> p;
+      strtk::token_grid grid(s, s.size(), options);
+      strtk::streaming_token_grid stream_grid(file_name, options, strtk::one_kilobyte);
 
-      for (int i = -10000000; i < +10000000; ++i)
+      std::vector<std::string> rows0;
+      std::vector<std::string> rows1;
+
+      grid.for_each_row(row_string_collector(rows0));
+      stream_grid.for_each_row(row_string_collector(rows1));
+
+      if ((rows0 != rows1) || (stream_grid.row_count() != grid.row_count()) || (stream_grid.window_count() < 2))
       {
-         float f = i * 0.7f;
-         strtk::type_to_string(f,s);
-         p = strtk::make_pair<const char*>(s);
-         float x = 0;
-         strtk::util::value v(x);
+         std::cout << "test_streaming_token_grid() - Failed for_each_row test" << std::endl;
+         result = false;
+      }
 
-         if (!v(p))
-         {
-            std::cout << "test_kv_parse() - (float) failed parse at index: " << i << std::endl;
-            return false;
-         }
+      std::vector<std::string> partitions0;
+      std::vector<std::string> partitions1;
 
-         if (not_equal(x,f,0.0000001f))
-         {
-            std::cout << "test_kv_parse() - (float) failed value test at index: " << i << " x:" << x << std::endl;
-            return false;
-         }
+      grid.sequential_partition(partition_transition(),partition_string_collector(partitions0));
+      stream_grid.sequential_partition(partition_transition(),partition_string_collector(partitions1));
+
+      if (partitions0 != partitions1)
+      {
+         std::cout << "test_streaming_token_grid() - Failed sequential_partition test" << std::endl;
+         result = false;
+      }
+
+      // Every row is passed to the predicate once.
+      std::size_t predicate_count = 0;
+
+      partitions1.clear();
+      stream_grid.sequential_partition(counting_partition_transition(predicate_count),
+                                       partition_string_collector(partitions1));
+
+      if ((partitions0 != partitions1) || (grid.row_count() != predicate_count))
+      {
+         std::cout << "test_streaming_token_grid() - Failed sequential_partition predicate test" << std::endl;
+         result = false;
       }
    }
 
    {
-      std::string s;
-      s.reserve(strtk::one_kilobyte);
-      std::pair<const char*, const char*> p;
+      // Partitions spanning several windows are reported in pieces.
+      std::string data;
 
-      for (int i = -10000000; i < +10000000; ++i)
+      for (std::size_t i = 0; i < 2000; ++i)
       {
-         double d = i * 0.7;
-         strtk::type_to_string(d,s);
-         p = strtk::make_pair<const char*>(s);
-         double x = 0;
-         strtk::util::value v(x);
+         data += ((0 == (i % 700)) ? "a" : "b") + strtk::type_to_string(i) + ",x\n";
+      }
 
-         if (!v(p))
-         {
-            std::cout << "test_kv_parse() - (double) failed parse at index: " << i << std::endl;
-            return false;
-         }
+      {
+         std::ofstream stream(file_name.c_str(),std::ios::binary);
+         stream.write(data.data(),static_cast<std::streamsize>(data.size()));
+      }
 
-         if (not_equal(x,d,0.0000001))
-         {
-            std::cout << "test_kv_parse() - (double) failed value test at index: " << i << " x:" << x << std::endl;
-            return false;
-         }
+      strtk::token_grid grid(data, data.size(), options);
+      strtk::streaming_token_grid stream_grid(file_name, options, strtk::one_kilobyte);
+
+      std::vector<std::string> partitions0;
+      std::vector<std::string> partitions1;
+      std::size_t predicate_count = 0;
+
+      grid.sequential_partition(partition_transition(),partition_string_collector(partitions0));
+      stream_grid.sequential_partition(counting_partition_transition(predicate_count),
+                                       partition_string_collector(partitions1));
+
+      std::string joined0;
+      std::string joined1;
+
+      for (std::size_t i = 0; i < partitions0.size(); ++i) joined0 += partitions0[i];
+      for (std::size_t i = 0; i < partitions1.size(); ++i) joined1 += partitions1[i];
+
+      if (
+           (joined0 != joined1) ||
+           (partitions1.size() <= partitions0.size()) ||
+           (grid.row_count() != predicate_count)
+         )
+      {
+         std::cout << "test_streaming_token_grid() - Failed partial partition test" << std::endl;
+         result = false;
       }
    }
 
-   return true;
-
-}
+   {
+      std::string data;
 
-bool test_replace_pattern()
-{
-   typedef std::pair<std::string,std::string> sp_type;
-   static const sp_type test[] = {
-                                   sp_type(   "a" ,   "x"),
-                                   sp_type(  "ab" ,  "xy"),
-                                   sp_type( "abc" , "xyz"),
-                                   sp_type(   "a" ,  "xy"),
-                                   sp_type(   "b" ,  "xy"),
-                                   sp_type(   "c" ,  "xy"),
-                                   sp_type(  "ab" ,   "x"),
-                                   sp_type(  "bc" ,   "x"),
-                                   sp_type(  "ca" ,   "x"),
-                                   sp_type(  "ab" , "xyz"),
-                                   sp_type(  "bc" , "xyz"),
-                                   sp_type(  "ca" , "xyz"),
-                                   sp_type( "abc" ,   "x"),
-                                   sp_type( "bca" ,   "x"),
-                                   sp_type( "cab" ,   "x"),
-                                   sp_type("abca" ,   "x"),
-                                   sp_type("bcab" ,   "x"),
-                                   sp_type("cabc" ,   "x"),
-                                   sp_type( "abc" ,    ""),
-                                   sp_type( "ijk" , "mno")
-                                 };
+      for (std::size_t i = 0; i < 10000; ++i)
+      {
+         data += strtk::type_to_string(i) + "," + strtk::type_to_string(i * 2) + "\n";
+      }
 
-   static const std::size_t test_size = sizeof(test) / sizeof(sp_type);
+      {
+         std::ofstream stream(file_name.c_str(),std::ios::binary);
+         stream.write(data.data(),static_cast<std::streamsize>(data.size()));
+      }
 
+      strtk::token_grid grid(data, data.size(), options);
+      strtk::streaming_token_grid stream_grid(file_name, options, strtk::one_kilobyte);
 
-   static const std::string base[] = {
-                                       "",
-                                       "abcabcabcabcabc",
-                                       "yyabcabcabcabcabc",
-                                       "yyabcabcabcabcabckkk",
-                                       "yyabcabcabcabcabckkk",
-                                       "yabctabcabctabcabtckk",
-                                       "xyzxyzxyzxyzxyzxyzxyzxyz"
-                                       "abc"
-                                     };
+      unsigned long long int sum0 = 0;
+      unsigned long long int sum1 = 0;
 
-   static const std::size_t base_size = sizeof(base) / sizeof(std::string);
+      const std::size_t count0 = grid.accumulate_column(1,sum0);
+      const std::size_t count1 = stream_grid.accumulate_column(1,sum1);
 
-   std::string result;
-   for (std::size_t i = 0; i < test_size; ++i)
-   {
-      for (std::size_t j = 0; j < base_size; ++j)
+      if ((count0 != count1) || (sum0 != sum1) || (10000 != count1))
       {
-         strtk::replace_pattern(base[j],test[i].first,test[i].second,result);
-         if (test[i].first != test[i].second)
-         {
-            if (std::string::npos != result.find(test[i].first))
-            {
-               std::cout << "replace_pattern: s[" << base[j] << "] p[" << test[i].first << "] r[" << test[i].second << "]" << std::endl;
-               return false;
-            }
-         }
+         std::cout << "test_streaming_token_grid() - Failed accumulate_column test" << std::endl;
+         result = false;
       }
    }
 
-   return true;
+   std::remove(file_name.c_str());
+
+   return result;
 }
 
 bool test_n_choose_k()
@@ -2888,9 +5589,18 @@ int main()
    result &= test_tokenizer_options();
    result &= test_split_options();
    result &= test_split_n();
+   result &= test_split_simd();
+   result &= test_split_batch();
+   result &= test_regex_dfa();
+   result &= test_multi_pattern_matcher();
+   result &= test_substring_searcher();
+   result &= test_multi_pattern_replace();
+   result &= test_wildcard_matcher();
+   result &= test_case_conversion_kernels();
    result &= test_empty_filter_itr();
    result &= test_construct_and_parse();
    result &= test_double_convert();
+   result &= test_double_convert_exact();
    result &= test_fast_convert();
    result &= test_int_uint_convert();
    result &= test_parse1();
@@ -2900,6 +5610,21 @@ int main()
    result &= test_kv_parse();
    result &= test_replace_pattern();
    result &= test_n_choose_k();
+   result &= test_token_grid_structural_index();
+   result &= test_token_grid_dquotes();
+   result &= test_token_grid_parallel_load();
+   result &= test_token_grid_memory_map();
+   result &= test_token_grid_append();
+   result &= test_token_grid_index_file();
+   result &= test_token_grid_compact_storage();
+   result &= test_token_grid_lazy_index();
+   result &= test_token_grid_column_cache();
+   result &= test_token_grid_parallel_column();
+   result &= test_token_grid_group_by();
+   result &= test_token_grid_column_profile();
+   result &= test_token_grid_hash_join();
+   result &= test_streaming_token_grid();
+   result &= test_token_grid_deferred_removal();
    result &= test_keyvalue_parser();
    return (false == result ? 1 : 0);
 }